@@ -27,7 +27,7 @@ from fprime_ac.models import ModelParser
 #
 # Python extension modules and custom interfaces
 #
-from fprime_ac.utils import ConfigManager
+from fprime_ac.utils import ConfigManager, TypesList
 
 #
 # Global logger init. below.
@@ -688,6 +688,34 @@ class ComponentVisitorBase(AbstractVisitor.AbstractVisitor):
         # Construct map: port name -> return type string
         c.port_return_type_strs = self.__model_parser.getPortReturnDict(obj)
 
+    def initTypedMessages(self, c):
+        """
+        Construct the list of async typed input ports whose arguments can
+        be copied into a queue message as a plain struct
+        """
+
+        def isPlainArg(arg):
+            (name, type, comment, modifier, enum, non_const_type) = arg
+            if modifier == "*":
+                return True
+            return modifier == "" and (
+                enum == "ENUM" or TypesList.isPrimitiveType(type)
+            )
+
+        c.typed_msg_ports = [
+            instance
+            for (
+                instance,
+                type,
+                sync,
+                priority,
+                full,
+                role,
+                max_num,
+            ) in c.message_calls_typed
+            if sync == "async" and all(map(isPlainArg, c.port_args[instance]))
+        ]
+
     def initPortNames(self, obj, c):
         """
         Set special port names
@@ -739,6 +767,7 @@ class ComponentVisitorBase(AbstractVisitor.AbstractVisitor):
         """
         self.initPortLists(obj, c)
         self.initPortMaps(obj, c)
+        self.initTypedMessages(c)
         self.initPortFlags(obj, c)
         self.initPortNames(obj, c)
         self.initPortParams(obj, c)
@@ -0,0 +1,87 @@
+// ======================================================================
+// \title  TypedMsgComponentImpl.cpp
+// \author Auto-generated
+// \brief  cpp file for TypedMsg component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+
+#include <Autocoders/Python/test/typed_msg/TypedMsgComponentImpl.hpp>
+#include "Fw/Types/BasicTypes.hpp"
+
+namespace ExampleComponents {
+
+  // ----------------------------------------------------------------------
+  // Construction, initialization, and destruction
+  // ----------------------------------------------------------------------
+
+  TypedMsgComponentImpl ::
+    TypedMsgComponentImpl(
+        const char *const compName
+    ) : TypedMsgComponentBase(compName),
+      m_calls(0),
+      m_portNum(-1),
+      m_key(0),
+      m_value(0.0),
+      m_mode(MODE_IDLE),
+      m_data(nullptr),
+      m_context(0)
+  {
+
+  }
+
+  void TypedMsgComponentImpl ::
+    init(
+        const NATIVE_INT_TYPE queueDepth,
+        const NATIVE_INT_TYPE instance
+    )
+  {
+    TypedMsgComponentBase::init(queueDepth, instance);
+  }
+
+  TypedMsgComponentImpl ::
+    ~TypedMsgComponentImpl()
+  {
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Handler implementations for user-defined typed input ports
+  // ----------------------------------------------------------------------
+
+  void TypedMsgComponentImpl ::
+    smallIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        U32 key,
+        F64 value,
+        SmallMode mode,
+        U8 *data
+    )
+  {
+    ++this->m_calls;
+    this->m_portNum = portNum;
+    this->m_key = key;
+    this->m_value = value;
+    this->m_mode = mode;
+    this->m_data = data;
+  }
+
+  void TypedMsgComponentImpl ::
+    comIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::ComBuffer &data,
+        U32 context
+    )
+  {
+    ++this->m_calls;
+    this->m_portNum = portNum;
+    this->m_com = data;
+    this->m_context = context;
+  }
+
+} // end namespace ExampleComponents
@@ -0,0 +1,113 @@
+// ======================================================================
+// \title  TypedMsgComponentImpl.hpp
+// \author Auto-generated
+// \brief  hpp file for TypedMsg component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TypedMsg_HPP
+#define TypedMsg_HPP
+
+#include "Autocoders/Python/test/typed_msg/TypedMsgComponentAc.hpp"
+
+namespace ExampleComponents {
+
+  class TypedMsgComponentImpl :
+    public TypedMsgComponentBase
+  {
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Construction, initialization, and destruction
+      // ----------------------------------------------------------------------
+
+      //! Construct object TypedMsg
+      //!
+      TypedMsgComponentImpl(
+          const char *const compName /*!< The component name*/
+      );
+
+      //! Initialize object TypedMsg
+      //!
+      void init(
+          const NATIVE_INT_TYPE queueDepth, //!< The queue depth
+          const NATIVE_INT_TYPE instance //!< The instance number
+      );
+
+      //! Destroy object TypedMsg
+      //!
+      ~TypedMsgComponentImpl();
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Handler implementations for user-defined typed input ports
+      // ----------------------------------------------------------------------
+
+      //! Handler implementation for smallIn
+      //!
+      void smallIn_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          U32 key, /*!< A key*/
+          F64 value, /*!< A value*/
+          SmallMode mode, /*!< A mode*/
+          U8 *data /*!< Some data*/
+      );
+
+      //! Handler implementation for comIn
+      //!
+      void comIn_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::ComBuffer &data, /*!< Buffer containing packet data*/
+          U32 context /*!< Call context value; meaning chosen by user*/
+      );
+
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Variables
+      // ----------------------------------------------------------------------
+
+      //! The number of handler calls
+      //!
+      U32 m_calls;
+
+      //! The port number of the last call
+      //!
+      NATIVE_INT_TYPE m_portNum;
+
+      //! The key of the last smallIn call
+      //!
+      U32 m_key;
+
+      //! The value of the last smallIn call
+      //!
+      F64 m_value;
+
+      //! The mode of the last smallIn call
+      //!
+      SmallMode m_mode;
+
+      //! The data of the last smallIn call
+      //!
+      U8 *m_data;
+
+      //! The buffer of the last comIn call
+      //!
+      Fw::ComBuffer m_com;
+
+      //! The context of the last comIn call
+      //!
+      U32 m_context;
+
+    };
+
+} // end namespace ExampleComponents
+
+#endif
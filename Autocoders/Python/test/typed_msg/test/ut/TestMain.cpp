@@ -0,0 +1,20 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "Tester.hpp"
+
+TEST(Nominal, SmallArgs) {
+    ExampleComponents::Tester tester;
+    tester.testSmallArgs();
+}
+
+TEST(Nominal, ComArgs) {
+    ExampleComponents::Tester tester;
+    tester.testComArgs();
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
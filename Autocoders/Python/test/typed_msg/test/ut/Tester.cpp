@@ -0,0 +1,124 @@
+// ======================================================================
+// \title  TypedMsg/test/ut/Tester.cpp
+// \author Auto-generated
+// \brief  cpp file for TypedMsg test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Tester.hpp"
+
+// These tests cover the plain struct messages for smallIn
+static_assert(FW_TYPED_ASYNC_MESSAGES, "typed_msg must be built with FW_TYPED_ASYNC_MESSAGES=1");
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 10
+#define QUEUE_DEPTH 10
+
+namespace ExampleComponents {
+
+  // ----------------------------------------------------------------------
+  // Construction and destruction
+  // ----------------------------------------------------------------------
+
+  Tester ::
+    Tester() :
+      TypedMsgGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("TypedMsg")
+  {
+    this->initComponents();
+    this->connectPorts();
+  }
+
+  Tester ::
+    ~Tester()
+  {
+
+  }
+
+  // ----------------------------------------------------------------------
+  // Tests
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    testSmallArgs()
+  {
+    U8 data[4];
+    this->invoke_to_smallIn(0, 0xDEADBEEF, -2.5, MODE_ACTIVE, data);
+    this->dispatchOne();
+    ASSERT_EQ(0, this->component.m_portNum);
+    ASSERT_EQ(0xDEADBEEF, this->component.m_key);
+    ASSERT_EQ(-2.5, this->component.m_value);
+    ASSERT_EQ(MODE_ACTIVE, this->component.m_mode);
+    ASSERT_EQ(data, this->component.m_data);
+
+    // A second call must not see anything left over from the first
+    this->invoke_to_smallIn(0, 1, 0.0, MODE_IDLE, nullptr);
+    this->dispatchOne();
+    ASSERT_EQ(1U, this->component.m_key);
+    ASSERT_EQ(0.0, this->component.m_value);
+    ASSERT_EQ(MODE_IDLE, this->component.m_mode);
+    ASSERT_TRUE(this->component.m_data == nullptr);
+    ASSERT_EQ(2U, this->component.m_calls);
+  }
+
+  void Tester ::
+    testComArgs()
+  {
+    Fw::ComBuffer com;
+    for (NATIVE_UINT_TYPE i = 0; i < com.getBuffCapacity(); i++) {
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK, com.serialize(static_cast<U8>(i)));
+    }
+    this->invoke_to_comIn(0, com, 42);
+    this->dispatchOne();
+    ASSERT_EQ(0, this->component.m_portNum);
+    ASSERT_EQ(42U, this->component.m_context);
+    ASSERT_TRUE(com == this->component.m_com);
+  }
+
+  // ----------------------------------------------------------------------
+  // Helper methods
+  // ----------------------------------------------------------------------
+
+  void Tester ::
+    connectPorts()
+  {
+
+    // smallIn
+    this->connect_to_smallIn(
+        0,
+        this->component.get_smallIn_InputPort(0)
+    );
+
+    // comIn
+    this->connect_to_comIn(
+        0,
+        this->component.get_comIn_InputPort(0)
+    );
+
+  }
+
+  void Tester ::
+    initComponents()
+  {
+    this->init();
+    this->component.init(
+        QUEUE_DEPTH,
+        INSTANCE
+    );
+  }
+
+  void Tester ::
+    dispatchOne()
+  {
+    ASSERT_EQ(
+        Fw::QueuedComponentBase::MSG_DISPATCH_OK,
+        this->component.doDispatch()
+    );
+  }
+
+} // end namespace ExampleComponents
@@ -0,0 +1,85 @@
+// ======================================================================
+// \title  TypedMsg/test/ut/Tester.hpp
+// \author Auto-generated
+// \brief  hpp file for TypedMsg test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include "GTestBase.hpp"
+#include "Autocoders/Python/test/typed_msg/TypedMsgComponentImpl.hpp"
+
+namespace ExampleComponents {
+
+  class Tester :
+    public TypedMsgGTestBase
+  {
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+    public:
+
+      //! Construct object Tester
+      //!
+      Tester();
+
+      //! Destroy object Tester
+      //!
+      ~Tester();
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Tests
+      // ----------------------------------------------------------------------
+
+      //! Invoke smallIn and check the arguments that reach the handler
+      //!
+      void testSmallArgs();
+
+      //! Invoke comIn and check the arguments that reach the handler
+      //!
+      void testComArgs();
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      //! Connect ports
+      //!
+      void connectPorts();
+
+      //! Initialize components
+      //!
+      void initComponents();
+
+      //! Dispatch one message and check that it was handled
+      //!
+      void dispatchOne();
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Variables
+      // ----------------------------------------------------------------------
+
+      //! The component under test
+      //!
+      TypedMsgComponentImpl component;
+
+  };
+
+} // end namespace ExampleComponents
+
+#endif
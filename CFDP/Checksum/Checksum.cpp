@@ -17,6 +17,16 @@ static U32 min(const U32 a, const U32 b) {
   return (a < b) ? a : b;
 }
 
+//! Assemble a big-endian word from four bytes. Compilers turn this
+//! into a single load (and byte swap on little-endian hosts).
+static inline U32 bigEndianWord(const U8 *const bytes) {
+  return
+    (static_cast<U32>(bytes[0]) << 24) |
+    (static_cast<U32>(bytes[1]) << 16) |
+    (static_cast<U32>(bytes[2]) << 8) |
+    static_cast<U32>(bytes[3]);
+}
+
 namespace CFDP {
 
   Checksum ::
@@ -90,8 +100,9 @@ namespace CFDP {
     }
 
     // Add the middle words aligned
-    for ( ; index + 4 <= length; index += 4)
-      addWordAligned(&data[index]);
+    const U32 numWords = (length - index) / 4;
+    this->addWordsAligned(&data[index], numWords);
+    index += 4 * numWords;
 
     // Add the last word unaligned if necessary
     if (index < length) {
@@ -106,10 +117,30 @@ namespace CFDP {
   }
 
   void Checksum ::
-    addWordAligned(const U8 *const word)
+    addWordsAligned(
+        const U8 *words,
+        const U32 numWords
+    )
   {
-    for (U8 i = 0; i < 4; ++i)
-      addByteAtOffset(word[i], i);
+    // Sum four words per step into independent accumulators. Addition
+    // mod 2^32 is associative, so the split does not change the result.
+    U32 sum0 = 0;
+    U32 sum1 = 0;
+    U32 sum2 = 0;
+    U32 sum3 = 0;
+    U32 i = 0;
+    for ( ; i + 4 <= numWords; i += 4) {
+      sum0 += bigEndianWord(&words[0]);
+      sum1 += bigEndianWord(&words[4]);
+      sum2 += bigEndianWord(&words[8]);
+      sum3 += bigEndianWord(&words[12]);
+      words += 16;
+    }
+    for ( ; i < numWords; ++i) {
+      sum0 += bigEndianWord(words);
+      words += 4;
+    }
+    this->value += sum0 + sum1 + sum2 + sum3;
   }
 
   void Checksum ::
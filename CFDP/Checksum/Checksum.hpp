@@ -77,9 +77,10 @@ namespace CFDP {
       // Private instance methods
       // ----------------------------------------------------------------------
 
-      //! Add a four-byte aligned word to the checksum value
-      void addWordAligned(
-          const U8 *const word //! The word
+      //! Add a run of four-byte aligned words to the checksum value
+      void addWordsAligned(
+          const U8 *words, //! The words
+          const U32 numWords //! The number of words
       );
 
       //! Add a four-byte unaligned word to the checksum value
@@ -5,6 +5,9 @@
 #include "gtest/gtest.h"
 
 #include "CFDP/Checksum/Checksum.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
 
 using namespace CFDP;
 
@@ -49,6 +52,76 @@ TEST(Checksum, ThreePackets) {
   ASSERT_EQ(expectedValue, checksum.getValue());
 }
 
+namespace {
+
+  //! Reference checksum computed one byte at a time
+  U32 referenceChecksum(U32 value, const U8 *const data, const U32 offset, const U32 length) {
+    for (U32 i = 0; i < length; ++i) {
+      value += static_cast<U32>(data[i]) << (8*(3 - (offset + i) % 4));
+    }
+    return value;
+  }
+
+  void fillRandom(std::vector<U8>& data) {
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<U8>(rand());
+    }
+  }
+
+}
+
+TEST(Checksum, MatchesReferenceForAllLengthsAndOffsets) {
+  std::vector<U8> bytes(256 + 4);
+  fillRandom(bytes);
+  // Vary the start offset and length so the head, word loop, and tail are covered
+  for (U32 offset = 0; offset < 8; ++offset) {
+    for (U32 length = 0; length <= 256; ++length) {
+      Checksum checksum(0x12345678);
+      checksum.update(&bytes[offset % 4], offset, length);
+      const U32 expected = referenceChecksum(0x12345678, &bytes[offset % 4], offset, length);
+      ASSERT_EQ(expected, checksum.getValue()) << "offset " << offset << " length " << length;
+    }
+  }
+}
+
+TEST(Checksum, RandomSplitsMatchReference) {
+  std::vector<U8> bytes(4096);
+  fillRandom(bytes);
+  const U32 expected = referenceChecksum(0, &bytes[0], 0, static_cast<U32>(bytes.size()));
+  for (U32 trial = 0; trial < 100; ++trial) {
+    Checksum checksum;
+    U32 index = 0;
+    while (index < bytes.size()) {
+      U32 chunk = static_cast<U32>(rand()) % 71;
+      if (index + chunk > bytes.size()) {
+        chunk = static_cast<U32>(bytes.size()) - index;
+      }
+      checksum.update(&bytes[index], index, chunk);
+      index += chunk;
+    }
+    ASSERT_EQ(expected, checksum.getValue());
+  }
+}
+
+TEST(Checksum, AlignedAndUnalignedBuffersMatch) {
+  // The same bytes checksum the same whether or not their address is
+  // word aligned, across the sizes the word loop is meant for
+  std::vector<U8> bytes(64 * 1024);
+  fillRandom(bytes);
+  std::vector<U8> shifted(bytes.size() + 4);
+  for (U32 size = 16; size <= bytes.size(); size *= 4) {
+    Checksum aligned;
+    aligned.update(&bytes[0], 0, size);
+    ASSERT_EQ(referenceChecksum(0, &bytes[0], 0, size), aligned.getValue()) << "size " << size;
+    for (U32 shift = 1; shift < 4; ++shift) {
+      std::copy(bytes.begin(), bytes.begin() + size, shifted.begin() + shift);
+      Checksum unaligned;
+      unaligned.update(&shifted[shift], 0, size);
+      ASSERT_EQ(aligned.getValue(), unaligned.getValue()) << "size " << size << " shift " << shift;
+    }
+  }
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -36,6 +36,7 @@
     #include <cstring>
 #elif defined TGT_OS_TYPE_LINUX || TGT_OS_TYPE_DARWIN
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <cerrno>
 #include <arpa/inet.h>
@@ -170,6 +171,76 @@ SocketIpStatus IpSocket::send(const U8* const data, const U32 size) {
     return SOCK_SUCCESS;
 }
 
+SocketIpStatus IpSocket::send(const U8* const data[], const U32 sizes[], const U32 count) {
+    FW_ASSERT(data != nullptr);
+    FW_ASSERT(sizes != nullptr);
+    FW_ASSERT(count <= SOCKET_SEND_MAX_GATHER, count);
+    const U8* remaining[SOCKET_SEND_MAX_GATHER];
+    U32 remainingSizes[SOCKET_SEND_MAX_GATHER];
+    U32 first = 0; // First buffer not yet completely sent
+    U32 size = 0;
+    U32 total = 0;
+    I32 sent  = 0;
+    for (U32 i = 0; i < count; i++) {
+        remaining[i] = data[i];
+        remainingSizes[i] = sizes[i];
+        size += sizes[i];
+    }
+    // Prevent transmission before connection, or after a disconnect
+    if (this->m_fd == -1) {
+        return SOCK_DISCONNECTED;
+    }
+    // Attempt to send out data and retry as necessary
+    for (U32 i = 0; (i < SOCKET_MAX_ITERATIONS) && (total < size); i++) {
+        // Send using my specific protocol
+        sent = this->sendGatherProtocol(remaining + first, remainingSizes + first, count - first);
+        // Error is EINTR or timeout just try again
+        if (((sent == -1) && (errno == EINTR)) || (sent == 0)) {
+            continue;
+        }
+        // Error bad file descriptor is a close along with reset
+        else if ((sent == -1) && ((errno == EBADF) || (errno == ECONNRESET))) {
+            this->close();
+            return SOCK_DISCONNECTED;
+        }
+        // Error returned, and it wasn't an interrupt nor a disconnect
+        else if (sent == -1) {
+            return SOCK_SEND_ERROR;
+        }
+        FW_ASSERT(sent > 0, sent);
+        total += sent;
+        // Step past the data sent, which may end part way through a buffer
+        for (U32 skip = static_cast<U32>(sent); skip > 0;) {
+            FW_ASSERT(first < count, first, count);
+            const U32 chunk = FW_MIN(skip, remainingSizes[first]);
+            remaining[first] += chunk;
+            remainingSizes[first] -= chunk;
+            skip -= chunk;
+            first += (remainingSizes[first] == 0) ? 1 : 0;
+        }
+    }
+    // Failed to retry enough to send all data
+    if (total < size) {
+        return SOCK_INTERRUPTED_TRY_AGAIN;
+    }
+    FW_ASSERT(total == size, total, size); // Ensure we sent everything
+    return SOCK_SUCCESS;
+}
+
+I32 IpSocket::sendGatherProtocol(const U8* const data[], const U32 sizes[], const U32 count) {
+    struct iovec vectors[SOCKET_SEND_MAX_GATHER];
+    struct msghdr message;
+    FW_ASSERT(count <= SOCKET_SEND_MAX_GATHER, count);
+    ::memset(&message, 0, sizeof(message));
+    for (U32 i = 0; i < count; i++) {
+        vectors[i].iov_base = const_cast<U8*>(data[i]);
+        vectors[i].iov_len = sizes[i];
+    }
+    message.msg_iov = vectors;
+    message.msg_iovlen = count;
+    return ::sendmsg(this->m_fd, &message, SOCKET_IP_SEND_FLAGS);
+}
+
 SocketIpStatus IpSocket::recv(U8* data, I32& req_read) {
     I32 size = 0;
     // Check for previously disconnected socket
@@ -111,6 +111,20 @@ class IpSocket {
      * \return status of the send, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
      */
     SocketIpStatus send(const U8* const data, const U32 size);
+    /**
+     * \brief send data gathered from several buffers out the IP socket
+     *
+     * Sends the buffers, in order, as one transmission without first copying them together. For Udp the buffers form a
+     * single datagram. Retries and errors are handled as for the single buffer `send`.
+     *
+     * Note: delegates to `sendGatherProtocol` to send the data
+     *
+     * \param data: pointers to each buffer to send
+     * \param sizes: size of each buffer to send
+     * \param count: number of buffers, at most SOCKET_SEND_MAX_GATHER
+     * \return status of the send, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
+     */
+    SocketIpStatus send(const U8* const data[], const U32 sizes[], const U32 count);
     /**
      * \brief receive data from the IP socket from the given buffer
      *
@@ -131,9 +145,10 @@ class IpSocket {
      * \brief closes the socket
      *
      * Closes the socket opened by the open call. In this case of the TcpServer, this does NOT close server's listening
-     * port (call `shutdown`) but will close the active client connection.
+     * port (call `shutdown`) but will close the active client connection. Sockets that serve several connections
+     * override this to close all of them.
      */
-    void close();
+    virtual void close();
 
   PROTECTED:
 
@@ -165,6 +180,18 @@ class IpSocket {
      */
     virtual I32 sendProtocol(const U8* const data, const U32 size) = 0;
 
+    /**
+     * \brief Protocol specific implementation of a gathered send.  Called directly with retry from send.
+     *
+     * Defaults to a single sendmsg call on the connected socket.
+     *
+     * \param data: pointers to each buffer to send
+     * \param sizes: size of each buffer to send
+     * \param count: number of buffers
+     * \return: size of data sent, or -1 on error.
+     */
+    virtual I32 sendGatherProtocol(const U8* const data[], const U32 sizes[], const U32 count);
+
     /**
      * \brief Protocol specific implementation of recv.  Called directly with error handling from recv.
      * \param data: data pointer to fill
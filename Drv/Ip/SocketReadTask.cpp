@@ -58,6 +58,27 @@ void SocketReadTask::stopSocketTask() {
     this->getSocketHandler().close();  // Break out of any receives
 }
 
+SocketIpStatus SocketReadTask::readSocket() {
+    Fw::Buffer buffer = this->getBuffer();
+    U8* data = buffer.getData();
+    FW_ASSERT(data);
+    I32 size = static_cast<I32>(buffer.getSize());
+    size = (size >= 0) ? size : MAXIMUM_SIZE; // Handle max U32 edge case
+    SocketIpStatus status = this->getSocketHandler().recv(data, size);
+    if ((status != SOCK_SUCCESS) && (status != SOCK_INTERRUPTED_TRY_AGAIN)) {
+        Fw::Logger::logMsg("[WARNING] Failed to recv from port with status %d and errno %d\n", status, errno);
+        this->getSocketHandler().close();
+        buffer.setSize(0);
+    } else {
+        // Send out received data
+        buffer.setSize(size);
+    }
+    this->sendBuffer(buffer, status);
+    return status;
+}
+
+void SocketReadTask::readStopped() {}
+
 void SocketReadTask::readTask(void* pointer) {
     FW_ASSERT(pointer);
     SocketIpStatus status = SOCK_SUCCESS;
@@ -72,26 +93,13 @@ void SocketReadTask::readTask(void* pointer) {
 
         // If the network connection is open, read from it
         if (self->getSocketHandler().isOpened() and (not self->m_stop)) {
-            Fw::Buffer buffer = self->getBuffer();
-            U8* data = buffer.getData();
-            FW_ASSERT(data);
-            I32 size = static_cast<I32>(buffer.getSize());
-            size = (size >= 0) ? size : MAXIMUM_SIZE; // Handle max U32 edge case
-            status = self->getSocketHandler().recv(data, size);
-            if ((status != SOCK_SUCCESS) && (status != SOCK_INTERRUPTED_TRY_AGAIN)) {
-                Fw::Logger::logMsg("[WARNING] Failed to recv from port with status %d and errno %d\n", status, errno);
-                self->getSocketHandler().close();
-                buffer.setSize(0);
-            } else {
-                // Send out received data
-                buffer.setSize(size);
-            }
-            self->sendBuffer(buffer, status);
+            status = self->readSocket();
         }
     }
     // As long as not told to stop, and we are successful interrupted or ordered to retry, keep receiving
     while (not self->m_stop &&
            (status == SOCK_SUCCESS || status == SOCK_INTERRUPTED_TRY_AGAIN || self->m_reconnect));
     self->getSocketHandler().close(); // Close the handler again, in case it reconnected
+    self->readStopped();
 }
 };  // namespace Drv
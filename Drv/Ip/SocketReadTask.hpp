@@ -138,6 +138,25 @@ class SocketReadTask {
      */
     virtual void connected() = 0;
 
+    /**
+     * \brief read from the opened socket and send out the data
+     *
+     * Called by the read task each time around its loop while the socket is open. Reads into one buffer from
+     * `getBuffer` and passes it to `sendBuffer`, closing the socket on error. Adaptations that can read several
+     * messages in one call may override this.
+     *
+     * \return status of the read
+     */
+    virtual SocketIpStatus readSocket();
+
+    /**
+     * \brief called by the read task once it has stopped reading
+     *
+     * Called on the read task after its loop exits, so adaptations holding buffers between reads may return them.
+     * Does nothing by default.
+     */
+    virtual void readStopped();
+
     /**
      * \brief a task designed to read from the socket and output incoming data
      *
@@ -0,0 +1,423 @@
+// ======================================================================
+// \title  TcpMultiServerSocket.cpp
+// \brief  cpp file for TcpMultiServerSocket core implementation classes
+//
+// \copyright
+// Copyright 2009-2020, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+#include <Drv/Ip/TcpMultiServerSocket.hpp>
+#include <Fw/Logger/Logger.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+
+#ifdef TGT_OS_TYPE_LINUX
+    #include <sys/socket.h>
+    #include <sys/eventfd.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <arpa/inet.h>
+    #include <cerrno>
+#else
+    #error OS not supported for multi-client TCP server, epoll is required
+#endif
+
+#include <cstring>
+
+namespace Drv {
+
+// Epoll event tags. Clients are tagged with their slot index
+static const U32 LISTEN_EVENT = SOCKET_SERVER_MAX_CLIENTS;
+static const U32 WAKE_EVENT = SOCKET_SERVER_MAX_CLIENTS + 1;
+static const NATIVE_INT_TYPE MAX_EVENTS = SOCKET_SERVER_MAX_CLIENTS + 2;
+
+TcpMultiServerSocket::TcpMultiServerSocket()
+    : IpSocket(), m_base_fd(-1), m_epoll_fd(-1), m_wake_fd(-1), m_nextClientId(1), m_uplinkId(0), m_eventCount(0), m_eventIndex(0) {
+    for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+        m_clients[i].fd = -1;
+        m_clients[i].sending = false;
+        m_clients[i].head = 0;
+        ::memset(&m_clients[i].stats, 0, sizeof(m_clients[i].stats));
+    }
+}
+
+SocketIpStatus TcpMultiServerSocket::startup() {
+    NATIVE_INT_TYPE serverFd = -1;
+    struct sockaddr_in address;
+    struct epoll_event event;
+    this->close();
+
+    // Acquire a socket, or return error
+    if ((serverFd = ::socket(AF_INET, SOCK_STREAM, 0)) == -1) {
+        return SOCK_FAILED_TO_GET_SOCKET;
+    }
+    // Set up the address port and name
+    address.sin_family = AF_INET;
+    address.sin_port = htons(this->m_port);
+
+    // First IP address to socket sin_addr
+    if (IpSocket::addressToIp4(m_hostname, &(address.sin_addr)) != SOCK_SUCCESS) {
+        ::close(serverFd);
+        return SOCK_INVALID_IP_ADDRESS;
+    };
+
+    // TCP requires bind to an address to the socket
+    if (::bind(serverFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) < 0) {
+        ::close(serverFd);
+        return SOCK_FAILED_TO_BIND;
+    }
+    // Clients are accepted until none are left pending, which must not block
+    if ((::listen(serverFd, SOCKET_SERVER_MAX_CLIENTS) < 0) ||
+        (::fcntl(serverFd, F_SETFL, ::fcntl(serverFd, F_GETFL) | O_NONBLOCK) < 0)) {
+        ::close(serverFd);
+        return SOCK_FAILED_TO_LISTEN;
+    }
+    // Wait on the listening socket and the wake-up event along with the clients
+    m_epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+    m_wake_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    event.events = EPOLLIN;
+    event.data.u32 = LISTEN_EVENT;
+    bool setup = (m_epoll_fd != -1) && (m_wake_fd != -1) &&
+                 (::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, serverFd, &event) == 0);
+    event.events = EPOLLIN;
+    event.data.u32 = WAKE_EVENT;
+    setup = setup && (::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_wake_fd, &event) == 0);
+    m_base_fd = serverFd;
+    if (not setup) {
+        this->shutdown();
+        return SOCK_FAILED_TO_SET_SOCKET_OPTIONS;
+    }
+    m_eventCount = 0;
+    m_eventIndex = 0;
+    Fw::Logger::logMsg("Listening for %u clients at %s:%hu\n", SOCKET_SERVER_MAX_CLIENTS,
+                       reinterpret_cast<POINTER_CAST>(m_hostname), m_port);
+    return SOCK_SUCCESS;
+}
+
+void TcpMultiServerSocket::shutdown() {
+    this->close();
+    if (m_base_fd != -1) {
+        (void)::shutdown(m_base_fd, SHUT_RDWR);
+        (void)::close(m_base_fd);
+        m_base_fd = -1;
+    }
+    if (m_epoll_fd != -1) {
+        (void)::close(m_epoll_fd);
+        m_epoll_fd = -1;
+    }
+    if (m_wake_fd != -1) {
+        (void)::close(m_wake_fd);
+        m_wake_fd = -1;
+    }
+}
+
+void TcpMultiServerSocket::close() {
+    m_clientLock.lock();
+    for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+        if (m_clients[i].fd != -1) {
+            this->removeClient(m_clients[i]);
+        }
+    }
+    m_clientLock.unLock();
+    // The epoll instance belongs to the listening socket, so only mark the server closed
+    m_lock.lock();
+    m_fd = -1;
+    m_open = false;
+    m_lock.unLock();
+    // Break the recv thread out of its wait so it sees the close
+    if (m_wake_fd != -1) {
+        const U64 wake = 1;
+        (void)::write(m_wake_fd, &wake, sizeof(wake));
+    }
+}
+
+SocketIpStatus TcpMultiServerSocket::sendTo(const U32 clientId, const U8* const data, const U32 size) {
+    SocketIpStatus status = SOCK_DISCONNECTED;
+    m_clientLock.lock();
+    for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+        if ((m_clients[i].fd != -1) && (m_clients[i].stats.id == clientId)) {
+            status = this->enqueue(m_clients[i], data, size) ? SOCK_SUCCESS : SOCK_INTERRUPTED_TRY_AGAIN;
+            break;
+        }
+    }
+    m_clientLock.unLock();
+    return status;
+}
+
+bool TcpMultiServerSocket::setUplinkClient(const U32 clientId) {
+    bool found = false;
+    m_clientLock.lock();
+    for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+        if ((m_clients[i].fd != -1) && (m_clients[i].stats.id == clientId)) {
+            m_uplinkId = clientId;
+            found = true;
+            break;
+        }
+    }
+    m_clientLock.unLock();
+    return found;
+}
+
+bool TcpMultiServerSocket::getClientStats(const U32 index, TcpClientStats& stats) {
+    FW_ASSERT(index < SOCKET_SERVER_MAX_CLIENTS, index);
+    m_clientLock.lock();
+    stats = m_clients[index].stats;
+    stats.uplink = stats.connected && (stats.id == m_uplinkId);
+    m_clientLock.unLock();
+    return stats.connected;
+}
+
+U32 TcpMultiServerSocket::getClientCount() {
+    U32 count = 0;
+    m_clientLock.lock();
+    for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+        count += (m_clients[i].fd != -1) ? 1 : 0;
+    }
+    m_clientLock.unLock();
+    return count;
+}
+
+SocketIpStatus TcpMultiServerSocket::openProtocol(NATIVE_INT_TYPE& fd) {
+    // Clients are accepted as they arrive by the recv thread, so there is nothing to wait for
+    if (m_epoll_fd == -1) {
+        return SOCK_FAILED_TO_ACCEPT;
+    }
+    m_eventCount = 0;
+    m_eventIndex = 0;
+    fd = m_epoll_fd;
+    return SOCK_SUCCESS;
+}
+
+I32 TcpMultiServerSocket::sendProtocol(const U8* const data, const U32 size) {
+    m_clientLock.lock();
+    for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+        if (m_clients[i].fd != -1) {
+            (void)this->enqueue(m_clients[i], data, size);
+        }
+    }
+    m_clientLock.unLock();
+    // Sends dropped for slow clients are counted against those clients rather than failing the send for everyone
+    return static_cast<I32>(size);
+}
+
+I32 TcpMultiServerSocket::sendGatherProtocol(const U8* const data[], const U32 sizes[], const U32 count) {
+    U32 size = 0;
+    for (U32 i = 0; i < count; i++) {
+        size += sizes[i];
+    }
+    m_clientLock.lock();
+    for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+        if (m_clients[i].fd != -1) {
+            (void)this->enqueue(m_clients[i], data, sizes, count);
+        }
+    }
+    m_clientLock.unLock();
+    return static_cast<I32>(size);
+}
+
+I32 TcpMultiServerSocket::recvProtocol(U8* const data, const U32 size) {
+    while (true) {
+        if (m_eventIndex >= m_eventCount) {
+            m_eventIndex = 0;
+            m_eventCount = ::epoll_wait(m_epoll_fd, m_events, MAX_EVENTS, -1);
+            if (m_eventCount < 0) {
+                m_eventCount = 0;
+                return -1;
+            }
+        }
+        const struct epoll_event& event = m_events[m_eventIndex];
+        m_eventIndex++;
+        if (event.data.u32 == WAKE_EVENT) {
+            U64 wake = 0;
+            (void)::read(m_wake_fd, &wake, sizeof(wake));
+            if (not this->isOpened()) {
+                errno = EBADF;
+                return -1;
+            }
+        } else if (event.data.u32 == LISTEN_EVENT) {
+            this->acceptClients();
+        } else {
+            FW_ASSERT(event.data.u32 < SOCKET_SERVER_MAX_CLIENTS, event.data.u32);
+            const I32 received = this->readClient(m_clients[event.data.u32], event.events, data, size);
+            if (received > 0) {
+                return received;
+            }
+        }
+    }
+}
+
+void TcpMultiServerSocket::acceptClients() {
+    NATIVE_INT_TYPE clientFd = -1;
+    while ((clientFd = ::accept4(m_base_fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) != -1) {
+        m_clientLock.lock();
+        U32 index = 0;
+        for (index = 0; (index < SOCKET_SERVER_MAX_CLIENTS) && (m_clients[index].fd != -1); index++) {}
+        if (index == SOCKET_SERVER_MAX_CLIENTS) {
+            m_clientLock.unLock();
+            (void)::close(clientFd);
+            Fw::Logger::logMsg("[WARNING] Rejected client at %s:%hu, %u clients already connected\n",
+                               reinterpret_cast<POINTER_CAST>(m_hostname), m_port, SOCKET_SERVER_MAX_CLIENTS);
+            continue;
+        }
+        Client& client = m_clients[index];
+        struct epoll_event event;
+        event.events = EPOLLIN;
+        event.data.u32 = index;
+        if (::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, clientFd, &event) != 0) {
+            m_clientLock.unLock();
+            (void)::close(clientFd);
+            continue;
+        }
+        client.fd = clientFd;
+        client.sending = false;
+        client.head = 0;
+        ::memset(&client.stats, 0, sizeof(client.stats));
+        client.stats.id = m_nextClientId;
+        client.stats.connected = true;
+        m_nextClientId++;
+        if (m_uplinkId == 0) {
+            m_uplinkId = client.stats.id;
+        }
+        m_clientLock.unLock();
+        Fw::Logger::logMsg("Accepted client %u at %s:%hu\n", client.stats.id,
+                           reinterpret_cast<POINTER_CAST>(m_hostname), m_port);
+    }
+}
+
+I32 TcpMultiServerSocket::readClient(Client& client, const U32 events, U8* const data, const U32 size) {
+    I32 received = 0;
+    m_clientLock.lock();
+    // The client may have been closed since the event was reported
+    if (client.fd == -1) {
+        m_clientLock.unLock();
+        return 0;
+    }
+    if (events & EPOLLOUT) {
+        this->flush(client);
+    }
+    if (events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+        received = static_cast<I32>(::recv(client.fd, data, size, MSG_DONTWAIT | SOCKET_IP_RECV_FLAGS));
+        if (received > 0) {
+            client.stats.bytesReceived += static_cast<U64>(received);
+            // Only the uplink client's data is passed on, so streams from different clients are never interleaved
+            if (client.stats.id != m_uplinkId) {
+                client.stats.bytesDiscarded += static_cast<U64>(received);
+                received = 0;
+            }
+        }
+        // Zero bytes read or a hard error is a disconnect of this client only
+        else if ((received == 0) || ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))) {
+            this->removeClient(client);
+            received = 0;
+        }
+    }
+    m_clientLock.unLock();
+    return received;
+}
+
+bool TcpMultiServerSocket::enqueue(Client& client, const U8* const data, const U32 size) {
+    const U8* const parts[1] = {data};
+    const U32 sizes[1] = {size};
+    return this->enqueue(client, parts, sizes, 1);
+}
+
+bool TcpMultiServerSocket::enqueue(Client& client, const U8* const data[], const U32 sizes[], const U32 count) {
+    FW_ASSERT(count <= SOCKET_SEND_MAX_GATHER, count);
+    U32 size = 0;
+    for (U32 i = 0; i < count; i++) {
+        size += sizes[i];
+    }
+    // Drop the whole send rather than part of it, so the client always sees whole sends
+    if (size > (SOCKET_SERVER_CLIENT_QUEUE_SIZE - client.stats.backlog)) {
+        client.stats.bytesDropped += size;
+        client.stats.sendsDropped++;
+        return false;
+    }
+    U32 sent = 0;
+    // Nothing ahead of this send, so try to write it straight out
+    if (client.stats.backlog == 0) {
+        struct iovec vectors[SOCKET_SEND_MAX_GATHER];
+        struct msghdr message;
+        ::memset(&message, 0, sizeof(message));
+        for (U32 i = 0; i < count; i++) {
+            vectors[i].iov_base = const_cast<U8*>(data[i]);
+            vectors[i].iov_len = sizes[i];
+        }
+        message.msg_iov = vectors;
+        message.msg_iovlen = count;
+        const ssize_t written = ::sendmsg(client.fd, &message, MSG_DONTWAIT | MSG_NOSIGNAL | SOCKET_IP_SEND_FLAGS);
+        sent = (written > 0) ? static_cast<U32>(written) : 0;
+        client.stats.bytesSent += sent;
+    }
+    // Queue the rest, wrapping around the end of the ring
+    U32 tail = (client.head + client.stats.backlog) % SOCKET_SERVER_CLIENT_QUEUE_SIZE;
+    U32 offset = 0; // Offset of the current part within the whole send
+    for (U32 i = 0; i < count; i++) {
+        while (sent < (offset + sizes[i])) {
+            const U32 chunk = FW_MIN(offset + sizes[i] - sent, SOCKET_SERVER_CLIENT_QUEUE_SIZE - tail);
+            ::memcpy(client.queue + tail, data[i] + (sent - offset), chunk);
+            tail = (tail + chunk) % SOCKET_SERVER_CLIENT_QUEUE_SIZE;
+            client.stats.backlog += chunk;
+            sent += chunk;
+        }
+        offset += sizes[i];
+    }
+    client.stats.maxBacklog = FW_MAX(client.stats.maxBacklog, client.stats.backlog);
+    if ((client.stats.backlog > 0) && (not client.sending)) {
+        this->watch(client, true);
+    }
+    return true;
+}
+
+void TcpMultiServerSocket::flush(Client& client) {
+    while (client.stats.backlog > 0) {
+        const U32 chunk = FW_MIN(client.stats.backlog, SOCKET_SERVER_CLIENT_QUEUE_SIZE - client.head);
+        const ssize_t written =
+            ::send(client.fd, client.queue + client.head, chunk, MSG_DONTWAIT | MSG_NOSIGNAL | SOCKET_IP_SEND_FLAGS);
+        if (written <= 0) {
+            break;
+        }
+        client.head = (client.head + static_cast<U32>(written)) % SOCKET_SERVER_CLIENT_QUEUE_SIZE;
+        client.stats.backlog -= static_cast<U32>(written);
+        client.stats.bytesSent += static_cast<U64>(written);
+    }
+    if ((client.stats.backlog == 0) && client.sending) {
+        this->watch(client, false);
+    }
+}
+
+void TcpMultiServerSocket::watch(Client& client, const bool sending) {
+    struct epoll_event event;
+    event.events = static_cast<U32>(EPOLLIN) | (sending ? static_cast<U32>(EPOLLOUT) : 0U);
+    event.data.u32 = static_cast<U32>(&client - m_clients);
+    (void)::epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, client.fd, &event);
+    client.sending = sending;
+}
+
+void TcpMultiServerSocket::removeClient(Client& client) {
+    FW_ASSERT(client.fd != -1);
+    // Closing the last descriptor of the client also removes it from the epoll instance
+    (void)::shutdown(client.fd, SHUT_RDWR);
+    (void)::close(client.fd);
+    client.fd = -1;
+    client.sending = false;
+    client.head = 0;
+    client.stats.connected = false;
+    client.stats.backlog = 0;
+    // Hand the uplink to the longest connected remaining client
+    if (client.stats.id == m_uplinkId) {
+        m_uplinkId = 0;
+        for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+            if ((m_clients[i].fd != -1) && ((m_uplinkId == 0) || (m_clients[i].stats.id < m_uplinkId))) {
+                m_uplinkId = m_clients[i].stats.id;
+            }
+        }
+    }
+    Fw::Logger::logMsg("Client %u disconnected from %s:%hu\n", client.stats.id,
+                       reinterpret_cast<POINTER_CAST>(m_hostname), m_port);
+}
+
+}  // namespace Drv
@@ -0,0 +1,182 @@
+// ======================================================================
+// \title  TcpMultiServerSocket.hpp
+// \brief  hpp file for TcpMultiServerSocket core implementation classes
+//
+// \copyright
+// Copyright 2009-2020, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+#ifndef DRV_TCPMULTISERVER_TCPHELPER_HPP_
+#define DRV_TCPMULTISERVER_TCPHELPER_HPP_
+
+#include <Fw/Types/BasicTypes.hpp>
+#include <Drv/Ip/IpSocket.hpp>
+#include <IpCfg.hpp>
+#include <Os/Mutex.hpp>
+
+#include <sys/epoll.h>
+
+namespace Drv {
+/**
+ * \brief Traffic counters for one client of a Drv::TcpMultiServerSocket
+ */
+struct TcpClientStats {
+    U32 id;             //!< Identifier of the client, unique for the life of the server. 0 when never connected
+    bool connected;     //!< Is the client still connected
+    bool uplink;        //!< Is the client the uplink client, whose data is passed to recv
+    U64 bytesReceived;  //!< Bytes received from the client
+    U64 bytesDiscarded; //!< Bytes received from the client and dropped because it was not the uplink client
+    U64 bytesSent;      //!< Bytes written to the client socket
+    U64 bytesDropped;   //!< Bytes not sent to the client because its queue was full
+    U32 sendsDropped;   //!< Sends not delivered to the client because its queue was full
+    U32 backlog;        //!< Bytes queued for the client that the socket has not yet accepted
+    U32 maxBacklog;     //!< Largest backlog seen for the client
+};
+
+/**
+ * \brief Helper for setting up Tcp using Berkley sockets as a server for several clients at once
+ *
+ * Serves up to SOCKET_SERVER_MAX_CLIENTS clients from the single thread calling `recv`, using epoll to wait on the
+ * listening socket and every client at once. Received data is a byte stream with no record of its client, so only one
+ * client, the uplink client, is read into `recv`. Data from the other clients is read and dropped, so it can neither
+ * block them nor corrupt the uplink stream. The first client to connect is the uplink client until it disconnects,
+ * when the longest connected remaining client takes over, or until `setUplinkClient` picks another. `send` queues the
+ * data for every client and writes as much as each client socket accepts without blocking. The rest is written by the
+ * `recv` thread as the client catches up. A send that does not fit in a client's queue of
+ * SOCKET_SERVER_CLIENT_QUEUE_SIZE bytes is dropped whole for that client, so a slow client never blocks the others and
+ * never receives part of a send.
+ *
+ * Only available on Linux.
+ */
+class TcpMultiServerSocket : public IpSocket {
+  public:
+    /**
+     * \brief Constructor for multi-client server socket tcp implementation
+     */
+    TcpMultiServerSocket();
+
+    /**
+     * \brief Opens the server socket and listens, does not block.
+     *
+     * Opens the server's listening socket such that this server can listen for incoming client requests. Clients that
+     * connect are accepted by the thread calling `recv`.
+     * \return status of the server socket setup.
+     */
+    SocketIpStatus startup();
+
+    /**
+     * \brief Shutdown client sockets, and listening server socket
+     */
+    void shutdown();
+
+    /**
+     * \brief closes every client connection
+     *
+     * Closes all clients and wakes the thread blocked in `recv`. Does not close the listening socket (call
+     * `shutdown`), so the server may be opened again.
+     */
+    void close();
+
+    /**
+     * \brief send data to one client only
+     *
+     * Queues the data for the client with the given id, as reported by `getClientStats`.
+     * \param clientId: id of the client to send to
+     * \param data: pointer to data to send
+     * \param size: size of data to send
+     * \return SOCK_SUCCESS when queued, SOCK_INTERRUPTED_TRY_AGAIN when the client queue is full and SOCK_DISCONNECTED
+     *         when no such client is connected
+     */
+    SocketIpStatus sendTo(const U32 clientId, const U8* const data, const U32 size);
+
+    /**
+     * \brief choose the client whose data is passed to `recv`
+     *
+     * Data already returned by `recv` from the previous uplink client is not recalled, so a switch is seen downstream
+     * like the previous client disconnecting.
+     * \param clientId: id of the client, as reported by `getClientStats`
+     * \return true if the client is connected and is now the uplink client
+     */
+    bool setUplinkClient(const U32 clientId);
+
+    /**
+     * \brief get the traffic counters of a client slot
+     *
+     * Slots are reused as clients come and go, so the counters of a slot describe its latest client.
+     * \param index: slot index, less than SOCKET_SERVER_MAX_CLIENTS
+     * \param stats: (output) counters of the slot
+     * \return true if the slot holds a connected client
+     */
+    bool getClientStats(const U32 index, TcpClientStats& stats);
+
+    /**
+     * \brief get the number of connected clients
+     * \return number of connected clients
+     */
+    U32 getClientCount();
+
+  PROTECTED:
+    /**
+     * \brief Tcp specific implementation for opening the server to its clients. Does not block.
+     * \param fd: (output) file descriptor opened. Only valid on SOCK_SUCCESS. Otherwise will be invalid
+     * \return status of open
+     */
+    SocketIpStatus openProtocol(NATIVE_INT_TYPE& fd);
+    /**
+     * \brief Queues data for every client.  Called directly with retry from send.
+     * \param data: data to send
+     * \param size: size of data to send
+     * \return: size of data sent, or -1 on error.
+     */
+    I32 sendProtocol(const U8* const data, const U32 size);
+    /**
+     * \brief Queues the buffers as one send for every client.  Called directly with retry from send.
+     * \param data: pointers to each buffer to send
+     * \param sizes: size of each buffer to send
+     * \param count: number of buffers
+     * \return: size of data sent, or -1 on error.
+     */
+    I32 sendGatherProtocol(const U8* const data[], const U32 sizes[], const U32 count);
+    /**
+     * \brief Waits for data from the uplink client, accepting clients, writing queued data and dropping the data of
+     * other clients meanwhile.
+     * \param data: data pointer to fill
+     * \param size: size of data buffer
+     * \return: size of data received, or -1 on error.
+     */
+    I32 recvProtocol( U8* const data, const U32 size);
+
+  PRIVATE:
+    //! A client connection and the data queued for it
+    struct Client {
+        NATIVE_INT_TYPE fd;  //!< File descriptor of the client, -1 when the slot is free
+        bool sending;        //!< Is epoll watching for the client socket to accept more data
+        U32 head;            //!< Queue index of the oldest queued byte
+        TcpClientStats stats;  //!< Traffic counters, stats.backlog is the number of queued bytes
+        U8 queue[SOCKET_SERVER_CLIENT_QUEUE_SIZE];  //!< Ring of bytes waiting to be written
+    };
+
+    void acceptClients(); //!< accept every pending client connection
+    I32 readClient(Client& client, const U32 events, U8* const data, const U32 size); //!< handle a client event
+    bool enqueue(Client& client, const U8* const data, const U32 size); //!< queue a send. Lock must be held
+    bool enqueue(Client& client, const U8* const data[], const U32 sizes[], const U32 count); //!< queue a gathered send. Lock must be held
+    void flush(Client& client); //!< write queued data without blocking. Lock must be held
+    void watch(Client& client, const bool sending); //!< set the epoll events watched for a client. Lock must be held
+    void removeClient(Client& client); //!< close a client connection. Lock must be held
+
+    NATIVE_INT_TYPE m_base_fd; //!< File descriptor of the listening socket
+    NATIVE_INT_TYPE m_epoll_fd; //!< File descriptor of the epoll instance
+    NATIVE_INT_TYPE m_wake_fd; //!< Event file descriptor used to wake the recv thread on close
+    Os::Mutex m_clientLock; //!< Guards the clients
+    Client m_clients[SOCKET_SERVER_MAX_CLIENTS]; //!< Client slots
+    U32 m_nextClientId; //!< Id given to the next accepted client
+    U32 m_uplinkId; //!< Id of the client whose data is passed to recv, 0 when none is connected
+    struct epoll_event m_events[SOCKET_SERVER_MAX_CLIENTS + 2]; //!< Events from the last epoll wait
+    NATIVE_INT_TYPE m_eventCount; //!< Number of events from the last epoll wait
+    NATIVE_INT_TYPE m_eventIndex; //!< Next event to handle
+};
+}  // namespace Drv
+
+#endif /* DRV_TCPMULTISERVER_TCPHELPER_HPP_ */
@@ -31,6 +31,8 @@
     #include <sys/socket.h>
     #include <unistd.h>
     #include <arpa/inet.h>
+    #include <sys/uio.h>
+    #include <cerrno>
 #else
     #error OS not supported for IP Socket Communications
 #endif
@@ -159,9 +161,150 @@ I32 UdpSocket::sendProtocol(const U8* const data, const U32 size) {
                     reinterpret_cast<struct sockaddr *>(&this->m_state->m_addr_send), sizeof(this->m_state->m_addr_send));
 }
 
+I32 UdpSocket::sendGatherProtocol(const U8* const data[], const U32 sizes[], const U32 count) {
+    FW_ASSERT(this->m_state->m_addr_send.sin_family != 0); // Make sure the address was previously setup
+    FW_ASSERT(count <= SOCKET_SEND_MAX_GATHER, count);
+    struct iovec vectors[SOCKET_SEND_MAX_GATHER];
+    struct msghdr message;
+    ::memset(&message, 0, sizeof(message));
+    for (U32 i = 0; i < count; i++) {
+        vectors[i].iov_base = const_cast<U8*>(data[i]);
+        vectors[i].iov_len = sizes[i];
+    }
+    message.msg_name = &this->m_state->m_addr_send;
+    message.msg_namelen = sizeof(this->m_state->m_addr_send);
+    message.msg_iov = vectors;
+    message.msg_iovlen = count;
+    return ::sendmsg(this->m_fd, &message, SOCKET_IP_SEND_FLAGS);
+}
+
 I32 UdpSocket::recvProtocol(U8* const data, const U32 size) {
     FW_ASSERT(this->m_state->m_addr_recv.sin_family != 0); // Make sure the address was previously setup
     return ::recvfrom(this->m_fd, data, size, SOCKET_IP_RECV_FLAGS, nullptr, nullptr);
 }
 
+#ifdef TGT_OS_TYPE_LINUX
+SocketIpStatus UdpSocket::recvBatch(U8* const data[], U32 sizes[], U32& count) {
+    FW_ASSERT(data != nullptr);
+    FW_ASSERT(sizes != nullptr);
+    FW_ASSERT((count > 0) && (count <= SOCKET_UDP_MAX_BATCH_SIZE), count);
+    FW_ASSERT(this->m_state->m_addr_recv.sin_family != 0); // Make sure the address was previously setup
+    const U32 capacity = count;
+    count = 0;
+    // Check for previously disconnected socket
+    if (this->m_fd == -1) {
+        return SOCK_DISCONNECTED;
+    }
+    struct mmsghdr messages[SOCKET_UDP_MAX_BATCH_SIZE];
+    struct iovec vectors[SOCKET_UDP_MAX_BATCH_SIZE];
+    ::memset(messages, 0, sizeof(messages[0]) * capacity);
+    for (U32 i = 0; i < capacity; i++) {
+        vectors[i].iov_base = data[i];
+        vectors[i].iov_len = sizes[i];
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+    NATIVE_INT_TYPE received = -1;
+    for (U32 i = 0; (i < SOCKET_MAX_ITERATIONS) && (received < 0); i++) {
+        // Wait for the first datagram only, then take what is already waiting
+        received = ::recvmmsg(this->m_fd, messages, capacity, MSG_WAITFORONE | SOCKET_IP_RECV_FLAGS, nullptr);
+        // Error is EINTR, just try again
+        if ((received == -1) && ((errno == EINTR) || (errno == EAGAIN))) {
+            continue;
+        }
+        // Nothing read, reset or bad fd means we've disconnected
+        else if ((received == 0) || ((received == -1) && ((errno == ECONNRESET) || (errno == EBADF)))) {
+            this->close();
+            return SOCK_DISCONNECTED;
+        }
+        // Error returned, and it wasn't an interrupt, nor a disconnect
+        else if (received == -1) {
+            return SOCK_READ_ERROR;
+        }
+    }
+    // Prevent interrupted socket being viewed as success
+    if (received < 0) {
+        return SOCK_INTERRUPTED_TRY_AGAIN;
+    }
+    for (NATIVE_INT_TYPE i = 0; i < received; i++) {
+        sizes[i] = messages[i].msg_len;
+    }
+    count = static_cast<U32>(received);
+    return SOCK_SUCCESS;
+}
+
+SocketIpStatus UdpSocket::sendBatch(const U8* const data[], const U32 sizes[], U32& count) {
+    FW_ASSERT(data != nullptr);
+    FW_ASSERT(sizes != nullptr);
+    FW_ASSERT(count <= SOCKET_UDP_MAX_BATCH_SIZE, count);
+    FW_ASSERT(this->m_state->m_addr_send.sin_family != 0); // Make sure the address was previously setup
+    const U32 total = count;
+    count = 0;
+    // Prevent transmission before connection, or after a disconnect
+    if (this->m_fd == -1) {
+        return SOCK_DISCONNECTED;
+    }
+    struct mmsghdr messages[SOCKET_UDP_MAX_BATCH_SIZE];
+    struct iovec vectors[SOCKET_UDP_MAX_BATCH_SIZE];
+    ::memset(messages, 0, sizeof(messages[0]) * total);
+    for (U32 i = 0; i < total; i++) {
+        vectors[i].iov_base = const_cast<U8*>(data[i]);
+        vectors[i].iov_len = sizes[i];
+        messages[i].msg_hdr.msg_name = &this->m_state->m_addr_send;
+        messages[i].msg_hdr.msg_namelen = sizeof(this->m_state->m_addr_send);
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+    // Attempt to send out data and retry as necessary
+    for (U32 i = 0; (i < SOCKET_MAX_ITERATIONS) && (count < total); i++) {
+        NATIVE_INT_TYPE sent = ::sendmmsg(this->m_fd, messages + count, total - count, SOCKET_IP_SEND_FLAGS);
+        // Error is EINTR or timeout just try again
+        if (((sent == -1) && ((errno == EINTR) || (errno == EAGAIN))) || (sent == 0)) {
+            continue;
+        }
+        // Error bad file descriptor is a close along with reset
+        else if ((sent == -1) && ((errno == EBADF) || (errno == ECONNRESET))) {
+            this->close();
+            return SOCK_DISCONNECTED;
+        }
+        // Error returned, and it wasn't an interrupt nor a disconnect
+        else if (sent == -1) {
+            return SOCK_SEND_ERROR;
+        }
+        count += static_cast<U32>(sent);
+    }
+    // Failed to retry enough to send all data
+    if (count < total) {
+        return SOCK_INTERRUPTED_TRY_AGAIN;
+    }
+    return SOCK_SUCCESS;
+}
+#else
+SocketIpStatus UdpSocket::recvBatch(U8* const data[], U32 sizes[], U32& count) {
+    FW_ASSERT(data != nullptr);
+    FW_ASSERT(sizes != nullptr);
+    FW_ASSERT((count > 0) && (count <= SOCKET_UDP_MAX_BATCH_SIZE), count);
+    // No batched receive, so receive a single datagram
+    I32 size = static_cast<I32>(sizes[0]);
+    SocketIpStatus status = this->recv(data[0], size);
+    count = (status == SOCK_SUCCESS) ? 1 : 0;
+    sizes[0] = (status == SOCK_SUCCESS) ? static_cast<U32>(size) : 0;
+    return status;
+}
+
+SocketIpStatus UdpSocket::sendBatch(const U8* const data[], const U32 sizes[], U32& count) {
+    FW_ASSERT(data != nullptr);
+    FW_ASSERT(sizes != nullptr);
+    FW_ASSERT(count <= SOCKET_UDP_MAX_BATCH_SIZE, count);
+    // No batched send, so send each datagram in turn
+    const U32 total = count;
+    SocketIpStatus status = SOCK_SUCCESS;
+    for (count = 0; (count < total) && (status == SOCK_SUCCESS); count++) {
+        status = this->send(data[count], sizes[count]);
+    }
+    count = (status == SOCK_SUCCESS) ? count : count - 1;
+    return status;
+}
+#endif
+
 }  // namespace Drv
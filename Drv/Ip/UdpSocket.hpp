@@ -75,6 +75,32 @@ class UdpSocket : public IpSocket {
      */
     SocketIpStatus configureRecv(const char* hostname, const U16 port);
 
+    /**
+     * \brief receive several datagrams in one call
+     *
+     * Blocks until a datagram arrives, then also takes any others already waiting, up to `count`, using a single
+     * recvmmsg call on Linux. Other platforms receive one datagram per call. Errors are handled as for `recv`.
+     *
+     * \param data: buffers to fill, one datagram each
+     * \param sizes: (in) capacity of each buffer (out) size of each datagram received
+     * \param count: (in) number of buffers, at most SOCKET_UDP_MAX_BATCH_SIZE (out) number of datagrams received
+     * \return status of the receive, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
+     */
+    SocketIpStatus recvBatch(U8* const data[], U32 sizes[], U32& count);
+
+    /**
+     * \brief send several datagrams in one call
+     *
+     * Sends each buffer as one datagram, using a single sendmmsg call on Linux where the socket accepts them all.
+     * Other platforms send one datagram per call. Errors are handled as for `send`.
+     *
+     * \param data: buffers to send, one datagram each
+     * \param sizes: size of each datagram
+     * \param count: (in) number of datagrams, at most SOCKET_UDP_MAX_BATCH_SIZE (out) number of datagrams sent
+     * \return status of the send, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
+     */
+    SocketIpStatus sendBatch(const U8* const data[], const U32 sizes[], U32& count);
+
   PROTECTED:
 
     /**
@@ -96,6 +122,14 @@ class UdpSocket : public IpSocket {
      * \return: size of data sent, or -1 on error.
      */
     I32 sendProtocol(const U8* const data, const U32 size);
+    /**
+     * \brief Sends the buffers as one datagram to the configured send address. Called directly with retry from send.
+     * \param data: pointers to each buffer to send
+     * \param sizes: size of each buffer to send
+     * \param count: number of buffers
+     * \return: size of data sent, or -1 on error.
+     */
+    I32 sendGatherProtocol(const U8* const data[], const U32 sizes[], const U32 count);
     /**
      * \brief Protocol specific implementation of recv.  Called directly with error handling from recv.
      * \param data: data pointer to fill
@@ -60,6 +60,21 @@ void send_recv(Drv::IpSocket& sender, Drv::IpSocket& receiver) {
     Drv::Test::validate_random_data(buffer_out, buffer_in, MAX_DRV_TEST_MESSAGE_SIZE);
 }
 
+void send_recv_gather(Drv::IpSocket& sender, Drv::IpSocket& receiver) {
+    I32 size = MAX_DRV_TEST_MESSAGE_SIZE;
+    U8 buffer_out[MAX_DRV_TEST_MESSAGE_SIZE] = {0};
+    U8 buffer_in[MAX_DRV_TEST_MESSAGE_SIZE] = {0};
+
+    // Send the data as a header, body and trailer, then receive it as one
+    Drv::Test::fill_random_data(buffer_out, MAX_DRV_TEST_MESSAGE_SIZE);
+    const U8* const parts[3] = {buffer_out, buffer_out + 8, buffer_out + MAX_DRV_TEST_MESSAGE_SIZE - 4};
+    const U32 sizes[3] = {8, MAX_DRV_TEST_MESSAGE_SIZE - 12, 4};
+    EXPECT_EQ(sender.send(parts, sizes, 3), Drv::SOCK_SUCCESS);
+    EXPECT_EQ(receiver.recv(buffer_in, size), Drv::SOCK_SUCCESS);
+    EXPECT_EQ(size, static_cast<I32>(MAX_DRV_TEST_MESSAGE_SIZE));
+    Drv::Test::validate_random_data(buffer_out, buffer_in, MAX_DRV_TEST_MESSAGE_SIZE);
+}
+
 bool wait_on_change(Drv::IpSocket &socket, bool open, U32 iterations) {
     for (U32 i = 0; i < iterations; i++) {
         if (open == socket.isOpened()) {
@@ -55,6 +55,13 @@ void fill_random_buffer(Fw::Buffer &buffer);
  */
 void send_recv(Drv::IpSocket& sender, Drv::IpSocket& receiver);
 
+/**
+ * Send/receive pair with the sent data gathered from three buffers.
+ * @param sender: sender of the pair
+ * @param receiver: receiver of pair
+ */
+void send_recv_gather(Drv::IpSocket& sender, Drv::IpSocket& receiver);
+
 /**
  * Wait on socket change.
  */
@@ -0,0 +1,408 @@
+//
+// Loopback stress tests for the multi-client tcp server
+//
+#include <gtest/gtest.h>
+#include <Drv/Ip/TcpClientSocket.hpp>
+#include <Drv/Ip/TcpMultiServerSocket.hpp>
+#include <Drv/Ip/SocketReadTask.hpp>
+#include <Drv/Ip/IpSocket.hpp>
+#include <Os/Log.hpp>
+#include <Os/TaskString.hpp>
+#include <Fw/Logger/Logger.hpp>
+#include <Drv/Ip/test/ut/PortSelector.hpp>
+#include <Drv/Ip/test/ut/SocketTestHelper.hpp>
+
+#include <sys/socket.h>
+#include <atomic>
+
+Os::Log logger;
+
+const U32 MESSAGE_SIZE = 1024;
+
+/**
+ * Fill a message with its sequence number followed by bytes derived from it.
+ */
+void fill_message(U8* message, U32 sequence) {
+    message[0] = static_cast<U8>(sequence >> 24);
+    message[1] = static_cast<U8>(sequence >> 16);
+    message[2] = static_cast<U8>(sequence >> 8);
+    message[3] = static_cast<U8>(sequence);
+    for (U32 i = 4; i < MESSAGE_SIZE; i++) {
+        message[i] = static_cast<U8>(sequence + i);
+    }
+}
+
+/**
+ * Check a message built by fill_message and return its sequence number.
+ */
+U32 check_message(const U8* message) {
+    U32 sequence = (static_cast<U32>(message[0]) << 24) | (static_cast<U32>(message[1]) << 16) |
+                   (static_cast<U32>(message[2]) << 8) | static_cast<U32>(message[3]);
+    for (U32 i = 4; i < MESSAGE_SIZE; i++) {
+        EXPECT_EQ(message[i], static_cast<U8>(sequence + i));
+    }
+    return sequence;
+}
+
+/**
+ * Runs the server's recv thread, which also accepts clients and writes queued data, and checks that what it receives
+ * is whole messages in order.
+ */
+class ServerReader : public Drv::SocketReadTask {
+  public:
+    ServerReader() : received(0), messages(0), misordered(0), m_filled(0) {}
+
+    Drv::IpSocket& getSocketHandler() { return server; }
+
+    Fw::Buffer getBuffer() { return Fw::Buffer(m_storage, sizeof(m_storage)); }
+
+    void sendBuffer(Fw::Buffer buffer, Drv::SocketIpStatus status) {
+        if (status == Drv::SOCK_SUCCESS) {
+            received += buffer.getSize();
+            for (U32 i = 0; i < buffer.getSize(); i++) {
+                m_message[m_filled] = buffer.getData()[i];
+                m_filled++;
+                if (m_filled == MESSAGE_SIZE) {
+                    misordered += (check_message(m_message) != messages) ? 1 : 0;
+                    messages++;
+                    m_filled = 0;
+                }
+            }
+        }
+    }
+
+    void connected() {}
+
+    Drv::TcpMultiServerSocket server;
+    std::atomic<U64> received;
+    std::atomic<U32> messages;
+    std::atomic<U32> misordered;
+
+  private:
+    U8 m_storage[MESSAGE_SIZE];
+    U8 m_message[MESSAGE_SIZE];
+    U32 m_filled;
+};
+
+/**
+ * Set a receive timeout on a client so a missing message fails the test instead of hanging it.
+ */
+void set_recv_timeout(Drv::IpSocket& socket, U32 milliseconds) {
+    struct timeval timeout;
+    timeout.tv_sec = milliseconds / 1000;
+    timeout.tv_usec = (milliseconds % 1000) * 1000;
+    setsockopt(socket.m_fd, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<char*>(&timeout), sizeof(timeout));
+}
+
+/**
+ * Read exactly one message from a client, returning false if none arrives. Reads the socket directly, since
+ * IpSocket::recv retries on a timeout.
+ */
+bool recv_message(Drv::TcpClientSocket& client, U8* message) {
+    U32 total = 0;
+    while (total < MESSAGE_SIZE) {
+        ssize_t size = ::recv(client.m_fd, message + total, MESSAGE_SIZE - total, 0);
+        if (size <= 0) {
+            return false;
+        }
+        total += static_cast<U32>(size);
+    }
+    return true;
+}
+
+/**
+ * Start a server with its recv thread and connect clients to it.
+ */
+void start(ServerReader& reader, Drv::TcpClientSocket* clients, U32 count) {
+    U16 port = Drv::Test::get_free_port();
+    ASSERT_NE(0, port);
+    reader.server.configure("127.0.0.1", port, 0, 100);
+    ASSERT_EQ(Drv::SOCK_SUCCESS, reader.server.startup());
+    Os::TaskString name("server reader");
+    reader.startSocketTask(name);
+    for (U32 i = 0; i < count; i++) {
+        clients[i].configure("127.0.0.1", port, 1, 0);
+        ASSERT_EQ(Drv::SOCK_SUCCESS, clients[i].open());
+        set_recv_timeout(clients[i], 1000);
+    }
+    for (U32 i = 0; i < 100 && reader.server.getClientCount() < count; i++) {
+        Os::Task::delay(10);
+    }
+    ASSERT_EQ(count, reader.server.getClientCount());
+}
+
+/**
+ * Wait for the server to have received the given number of bytes from the client in a slot.
+ */
+void wait_received(ServerReader& reader, U32 index, U64 bytes) {
+    Drv::TcpClientStats stats;
+    ASSERT_TRUE(reader.server.getClientStats(index, stats));
+    for (U32 i = 0; i < 500 && stats.bytesReceived < bytes; i++) {
+        Os::Task::delay(10);
+        ASSERT_TRUE(reader.server.getClientStats(index, stats));
+    }
+    ASSERT_EQ(bytes, stats.bytesReceived);
+}
+
+void stop(ServerReader& reader, Drv::TcpClientSocket* clients, U32 count) {
+    for (U32 i = 0; i < count; i++) {
+        clients[i].close();
+    }
+    reader.stopSocketTask();
+    (void)reader.joinSocketTask(nullptr);
+    reader.server.shutdown();
+}
+
+TEST(MultiServer, FanOutToAllClients) {
+    const U32 CLIENTS = 4;
+    const U32 MESSAGES = 1000;
+    ServerReader reader;
+    Drv::TcpClientSocket clients[CLIENTS];
+    start(reader, clients, CLIENTS);
+
+    U8 message[MESSAGE_SIZE];
+    U8 incoming[MESSAGE_SIZE];
+    for (U32 sequence = 0; sequence < MESSAGES; sequence++) {
+        fill_message(message, sequence);
+        ASSERT_EQ(Drv::SOCK_SUCCESS, reader.server.send(message, MESSAGE_SIZE));
+        for (U32 i = 0; i < CLIENTS; i++) {
+            ASSERT_TRUE(recv_message(clients[i], incoming));
+            ASSERT_EQ(sequence, check_message(incoming));
+        }
+    }
+    for (U32 i = 0; i < CLIENTS; i++) {
+        Drv::TcpClientStats stats;
+        ASSERT_TRUE(reader.server.getClientStats(i, stats));
+        EXPECT_EQ(static_cast<U64>(MESSAGES) * MESSAGE_SIZE, stats.bytesSent);
+        EXPECT_EQ(0U, stats.sendsDropped);
+        EXPECT_EQ(0U, stats.backlog);
+    }
+    stop(reader, clients, CLIENTS);
+}
+
+TEST(MultiServer, SendToOneClient) {
+    const U32 CLIENTS = 2;
+    ServerReader reader;
+    Drv::TcpClientSocket clients[CLIENTS];
+    start(reader, clients, CLIENTS);
+
+    U8 message[MESSAGE_SIZE];
+    U8 incoming[MESSAGE_SIZE];
+    Drv::TcpClientStats first;
+    Drv::TcpClientStats second;
+    ASSERT_TRUE(reader.server.getClientStats(0, first));
+    ASSERT_TRUE(reader.server.getClientStats(1, second));
+    fill_message(message, 7);
+    ASSERT_EQ(Drv::SOCK_SUCCESS, reader.server.sendTo(second.id, message, MESSAGE_SIZE));
+    // Only the selected client gets the message, so the other sees the next one first
+    fill_message(message, 8);
+    ASSERT_EQ(Drv::SOCK_SUCCESS, reader.server.send(message, MESSAGE_SIZE));
+    Drv::TcpClientSocket& selected = (second.id == 2) ? clients[1] : clients[0];
+    Drv::TcpClientSocket& other = (second.id == 2) ? clients[0] : clients[1];
+    ASSERT_TRUE(recv_message(selected, incoming));
+    EXPECT_EQ(7U, check_message(incoming));
+    ASSERT_TRUE(recv_message(selected, incoming));
+    EXPECT_EQ(8U, check_message(incoming));
+    ASSERT_TRUE(recv_message(other, incoming));
+    EXPECT_EQ(8U, check_message(incoming));
+    EXPECT_EQ(Drv::SOCK_DISCONNECTED, reader.server.sendTo(first.id + second.id, message, MESSAGE_SIZE));
+    stop(reader, clients, CLIENTS);
+}
+
+TEST(MultiServer, SlowClientDoesNotBlockOthers) {
+    const U32 MESSAGES = 20000;
+    ServerReader reader;
+    Drv::TcpClientSocket clients[2];
+    start(reader, clients, 2);
+    Drv::TcpClientStats stats;
+    ASSERT_TRUE(reader.server.getClientStats(0, stats));
+    const U32 fastId = stats.id;
+    Drv::TcpClientSocket& fast = (fastId == 1) ? clients[0] : clients[1];
+    Drv::TcpClientSocket& slow = (fastId == 1) ? clients[1] : clients[0];
+
+    // The slow client reads nothing while the fast one keeps up, so its kernel buffers and then its queue fill
+    U8 message[MESSAGE_SIZE];
+    U8 incoming[MESSAGE_SIZE];
+    for (U32 sequence = 0; sequence < MESSAGES; sequence++) {
+        fill_message(message, sequence);
+        ASSERT_EQ(Drv::SOCK_SUCCESS, reader.server.send(message, MESSAGE_SIZE));
+        ASSERT_TRUE(recv_message(fast, incoming));
+        ASSERT_EQ(sequence, check_message(incoming));
+    }
+    U32 slowMessages = 0;
+    for (U32 i = 0; i < 2; i++) {
+        ASSERT_TRUE(reader.server.getClientStats(i, stats));
+        if (stats.id == fastId) {
+            EXPECT_EQ(0U, stats.sendsDropped);
+        } else {
+            EXPECT_GT(stats.sendsDropped, 0U);
+            EXPECT_LE(stats.maxBacklog, static_cast<U32>(SOCKET_SERVER_CLIENT_QUEUE_SIZE));
+            EXPECT_EQ(static_cast<U64>(MESSAGES) * MESSAGE_SIZE,
+                      stats.bytesSent + stats.backlog + stats.bytesDropped);
+            slowMessages = static_cast<U32>((stats.bytesSent + stats.backlog) / MESSAGE_SIZE);
+        }
+    }
+    // The slow client still gets whole messages in order, with gaps where sends were dropped
+    I64 last = -1;
+    for (U32 received = 0; received < slowMessages; received++) {
+        ASSERT_TRUE(recv_message(slow, incoming));
+        const U32 sequence = check_message(incoming);
+        ASSERT_GT(static_cast<I64>(sequence), last);
+        last = sequence;
+    }
+    ASSERT_GT(slowMessages, 0U);
+    stop(reader, clients, 2);
+}
+
+TEST(MultiServer, GatheredSendsStayWhole) {
+    const U32 MESSAGES = 20000;
+    ServerReader reader;
+    Drv::TcpClientSocket clients[2];
+    start(reader, clients, 2);
+    Drv::TcpClientStats stats;
+    ASSERT_TRUE(reader.server.getClientStats(0, stats));
+    const U32 fastId = stats.id;
+    Drv::TcpClientSocket& fast = (fastId == 1) ? clients[0] : clients[1];
+    Drv::TcpClientSocket& slow = (fastId == 1) ? clients[1] : clients[0];
+
+    // Each message is sent as a header, body and trailer. Parts are queued or dropped together with their message
+    U8 message[MESSAGE_SIZE];
+    U8 incoming[MESSAGE_SIZE];
+    const U8* const parts[3] = {message, message + 8, message + MESSAGE_SIZE - 4};
+    const U32 sizes[3] = {8, MESSAGE_SIZE - 12, 4};
+    for (U32 sequence = 0; sequence < MESSAGES; sequence++) {
+        fill_message(message, sequence);
+        ASSERT_EQ(Drv::SOCK_SUCCESS, reader.server.send(parts, sizes, 3));
+        ASSERT_TRUE(recv_message(fast, incoming));
+        ASSERT_EQ(sequence, check_message(incoming));
+    }
+    U32 slowMessages = 0;
+    for (U32 i = 0; i < 2; i++) {
+        ASSERT_TRUE(reader.server.getClientStats(i, stats));
+        if (stats.id != fastId) {
+            EXPECT_EQ(0U, (stats.bytesSent + stats.backlog) % MESSAGE_SIZE);
+            slowMessages = static_cast<U32>((stats.bytesSent + stats.backlog) / MESSAGE_SIZE);
+        }
+    }
+    I64 last = -1;
+    for (U32 received = 0; received < slowMessages; received++) {
+        ASSERT_TRUE(recv_message(slow, incoming));
+        const U32 sequence = check_message(incoming);
+        ASSERT_GT(static_cast<I64>(sequence), last);
+        last = sequence;
+    }
+    ASSERT_GT(slowMessages, 0U);
+    stop(reader, clients, 2);
+}
+
+TEST(MultiServer, ReceiveFromManyClients) {
+    const U32 MESSAGES = 500;
+    ServerReader reader;
+    Drv::TcpClientSocket clients[SOCKET_SERVER_MAX_CLIENTS];
+    start(reader, clients, SOCKET_SERVER_MAX_CLIENTS);
+
+    // One client too many is turned away
+    Drv::TcpClientSocket extra;
+    extra.configure("127.0.0.1", reader.server.m_port, 1, 0);
+    ASSERT_EQ(Drv::SOCK_SUCCESS, extra.open());
+    set_recv_timeout(extra, 1000);
+    U8 incoming[MESSAGE_SIZE];
+    EXPECT_FALSE(recv_message(extra, incoming));
+    extra.close();
+
+    // Every client sends, but only the first client's data reaches recv, unmixed with the others
+    U8 message[MESSAGE_SIZE];
+    for (U32 sequence = 0; sequence < MESSAGES; sequence++) {
+        fill_message(message, sequence);
+        for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+            ASSERT_EQ(Drv::SOCK_SUCCESS, clients[i].send(message, MESSAGE_SIZE));
+        }
+    }
+    const U64 expected = static_cast<U64>(MESSAGES) * MESSAGE_SIZE;
+    for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+        wait_received(reader, i, expected);
+    }
+    EXPECT_EQ(expected, reader.received);
+    EXPECT_EQ(MESSAGES, reader.messages);
+    EXPECT_EQ(0U, reader.misordered);
+    for (U32 i = 0; i < SOCKET_SERVER_MAX_CLIENTS; i++) {
+        Drv::TcpClientStats stats;
+        ASSERT_TRUE(reader.server.getClientStats(i, stats));
+        EXPECT_EQ(expected, stats.bytesReceived);
+        EXPECT_EQ(stats.id == 1, stats.uplink);
+        EXPECT_EQ(stats.uplink ? 0 : expected, stats.bytesDiscarded);
+    }
+    stop(reader, clients, SOCKET_SERVER_MAX_CLIENTS);
+}
+
+TEST(MultiServer, UplinkClientChanges) {
+    const U32 CLIENTS = 3;
+    ServerReader reader;
+    Drv::TcpClientSocket clients[CLIENTS];
+    start(reader, clients, CLIENTS);
+    for (U32 i = 0; i < CLIENTS; i++) {
+        Drv::TcpClientStats stats;
+        ASSERT_TRUE(reader.server.getClientStats(i, stats));
+        ASSERT_EQ(i + 1, stats.id);
+    }
+
+    // Each round every client sends the next message, and the uplink client at the time is the only one heard
+    U8 message[MESSAGE_SIZE];
+    U32 sequence = 0;
+    U64 sent = 0;
+    fill_message(message, sequence);
+    for (U32 i = 0; i < CLIENTS; i++) {
+        ASSERT_EQ(Drv::SOCK_SUCCESS, clients[i].send(message, MESSAGE_SIZE));
+    }
+    sequence++;
+    sent += MESSAGE_SIZE;
+    for (U32 i = 0; i < CLIENTS; i++) {
+        wait_received(reader, i, sent);
+    }
+    EXPECT_EQ(1U, reader.messages);
+
+    // Choose the last client
+    EXPECT_FALSE(reader.server.setUplinkClient(CLIENTS + 1));
+    ASSERT_TRUE(reader.server.setUplinkClient(CLIENTS));
+    fill_message(message, sequence);
+    for (U32 i = 0; i < CLIENTS; i++) {
+        ASSERT_EQ(Drv::SOCK_SUCCESS, clients[i].send(message, MESSAGE_SIZE));
+    }
+    sequence++;
+    sent += MESSAGE_SIZE;
+    for (U32 i = 0; i < CLIENTS; i++) {
+        wait_received(reader, i, sent);
+    }
+    EXPECT_EQ(2U, reader.messages);
+
+    // When it leaves, the longest connected client takes over
+    clients[CLIENTS - 1].close();
+    for (U32 i = 0; i < 100 && reader.server.getClientCount() == CLIENTS; i++) {
+        Os::Task::delay(10);
+    }
+    ASSERT_EQ(CLIENTS - 1, reader.server.getClientCount());
+    fill_message(message, sequence);
+    for (U32 i = 0; i < CLIENTS - 1; i++) {
+        ASSERT_EQ(Drv::SOCK_SUCCESS, clients[i].send(message, MESSAGE_SIZE));
+    }
+    sent += MESSAGE_SIZE;
+    for (U32 i = 0; i < CLIENTS - 1; i++) {
+        wait_received(reader, i, sent);
+    }
+    EXPECT_EQ(3U, reader.messages);
+    EXPECT_EQ(0U, reader.misordered);
+
+    Drv::TcpClientStats stats;
+    ASSERT_TRUE(reader.server.getClientStats(0, stats));
+    EXPECT_TRUE(stats.uplink);
+    EXPECT_EQ(static_cast<U64>(MESSAGE_SIZE), stats.bytesDiscarded);
+    ASSERT_TRUE(reader.server.getClientStats(1, stats));
+    EXPECT_FALSE(stats.uplink);
+    EXPECT_EQ(sent, stats.bytesDiscarded);
+    stop(reader, clients, CLIENTS - 1);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
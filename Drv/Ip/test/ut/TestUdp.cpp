@@ -47,6 +47,7 @@ void test_with_loop(U32 iterations, bool duplex) {
             Drv::Test::force_recv_timeout(udp1);
             Drv::Test::force_recv_timeout(udp2);
             Drv::Test::send_recv(udp1, udp2);
+            Drv::Test::send_recv_gather(udp1, udp2);
             // Allow duplex connections
             if (duplex) {
                 Drv::Test::send_recv(udp2, udp1);
@@ -73,6 +74,118 @@ TEST(SingleSide, TestSingleSideMultipleUdp) {
     test_with_loop(100, true);
 }
 
+namespace {
+    const U32 BATCH_COUNT = 10;
+    const U32 DATAGRAM_SIZE = 64;
+
+    //! Open a sender to receiver pair of sockets on loopback
+    bool open_pair(Drv::UdpSocket& sender, Drv::UdpSocket& receiver) {
+        U16 port = Drv::Test::get_free_port();
+        EXPECT_NE(0, port);
+        sender.configureSend("127.0.0.1", port, 0, 100);
+        receiver.configureRecv("127.0.0.1", port);
+        EXPECT_EQ(Drv::SOCK_SUCCESS, sender.open());
+        EXPECT_EQ(Drv::SOCK_SUCCESS, receiver.open());
+        Drv::Test::force_recv_timeout(receiver);
+        return sender.isOpened() && receiver.isOpened();
+    }
+}
+
+TEST(Batch, RecvBatch) {
+    Drv::UdpSocket sender;
+    Drv::UdpSocket receiver;
+    ASSERT_TRUE(open_pair(sender, receiver));
+    U8 sent[BATCH_COUNT][DATAGRAM_SIZE];
+    for (U32 i = 0; i < BATCH_COUNT; i++) {
+        Drv::Test::fill_random_data(sent[i], DATAGRAM_SIZE);
+        ASSERT_EQ(Drv::SOCK_SUCCESS, sender.send(sent[i], i + 1));
+    }
+    // Datagrams keep their own boundaries and arrive in order
+    U8 storage[BATCH_COUNT][DATAGRAM_SIZE];
+    U8* data[BATCH_COUNT];
+    U32 sizes[BATCH_COUNT];
+    U32 received = 0;
+    while (received < BATCH_COUNT) {
+        U32 count = BATCH_COUNT - received;
+        for (U32 i = 0; i < count; i++) {
+            data[i] = storage[received + i];
+            sizes[i] = DATAGRAM_SIZE;
+        }
+        ASSERT_EQ(Drv::SOCK_SUCCESS, receiver.recvBatch(data, sizes, count));
+        ASSERT_GT(count, 0);
+        for (U32 i = 0; i < count; i++) {
+            ASSERT_EQ(received + i + 1, sizes[i]);
+            Drv::Test::validate_random_data(storage[received + i], sent[received + i], sizes[i]);
+        }
+        received += count;
+    }
+    sender.close();
+    receiver.close();
+}
+
+TEST(Batch, SendBatch) {
+    Drv::UdpSocket sender;
+    Drv::UdpSocket receiver;
+    ASSERT_TRUE(open_pair(sender, receiver));
+    U8 sent[BATCH_COUNT][DATAGRAM_SIZE];
+    const U8* data[BATCH_COUNT];
+    U32 sizes[BATCH_COUNT];
+    for (U32 i = 0; i < BATCH_COUNT; i++) {
+        Drv::Test::fill_random_data(sent[i], DATAGRAM_SIZE);
+        data[i] = sent[i];
+        sizes[i] = DATAGRAM_SIZE - i;
+    }
+    U32 count = BATCH_COUNT;
+    ASSERT_EQ(Drv::SOCK_SUCCESS, sender.sendBatch(data, sizes, count));
+    ASSERT_EQ(BATCH_COUNT, count);
+    for (U32 i = 0; i < BATCH_COUNT; i++) {
+        U8 buffer[DATAGRAM_SIZE];
+        I32 size = DATAGRAM_SIZE;
+        ASSERT_EQ(Drv::SOCK_SUCCESS, receiver.recv(buffer, size));
+        ASSERT_EQ(DATAGRAM_SIZE - i, static_cast<U32>(size));
+        Drv::Test::validate_random_data(buffer, sent[i], size);
+    }
+    sender.close();
+    receiver.close();
+}
+
+TEST(Batch, RecvWaitingTogether) {
+    Drv::UdpSocket sender;
+    Drv::UdpSocket receiver;
+    ASSERT_TRUE(open_pair(sender, receiver));
+    U8 sent[SOCKET_UDP_MAX_BATCH_SIZE][DATAGRAM_SIZE];
+    const U8* out[SOCKET_UDP_MAX_BATCH_SIZE];
+    U32 sizes[SOCKET_UDP_MAX_BATCH_SIZE];
+    for (U32 i = 0; i < SOCKET_UDP_MAX_BATCH_SIZE; i++) {
+        Drv::Test::fill_random_data(sent[i], DATAGRAM_SIZE);
+        out[i] = sent[i];
+        sizes[i] = DATAGRAM_SIZE;
+    }
+    U32 count = SOCKET_UDP_MAX_BATCH_SIZE;
+    ASSERT_EQ(Drv::SOCK_SUCCESS, sender.sendBatch(out, sizes, count));
+    ASSERT_EQ(SOCKET_UDP_MAX_BATCH_SIZE, count);
+    // Every datagram already waiting is taken by one call where recvmmsg is available
+    U8 storage[SOCKET_UDP_MAX_BATCH_SIZE][DATAGRAM_SIZE];
+    U8* data[SOCKET_UDP_MAX_BATCH_SIZE];
+    for (U32 i = 0; i < SOCKET_UDP_MAX_BATCH_SIZE; i++) {
+        data[i] = storage[i];
+        sizes[i] = DATAGRAM_SIZE;
+    }
+    count = SOCKET_UDP_MAX_BATCH_SIZE;
+    ASSERT_EQ(Drv::SOCK_SUCCESS, receiver.recvBatch(data, sizes, count));
+#ifdef TGT_OS_TYPE_LINUX
+    ASSERT_EQ(SOCKET_UDP_MAX_BATCH_SIZE, count);
+#else
+    ASSERT_EQ(1U, count);
+#endif
+    for (U32 i = 0; i < count; i++) {
+        ASSERT_EQ(DATAGRAM_SIZE, sizes[i]);
+        Drv::Test::validate_random_data(storage[i], sent[i], sizes[i]);
+    }
+    sender.close();
+    receiver.close();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -78,6 +78,21 @@ Drv::SendStatus TcpClientComponentImpl::send_handler(const NATIVE_INT_TYPE portN
     return SendStatus::SEND_OK;
 }
 
+Drv::SendStatus TcpClientComponentImpl::sendGather_handler(const NATIVE_INT_TYPE portNum,
+                                                           Fw::Buffer& header,
+                                                           Fw::Buffer& payload,
+                                                           Fw::Buffer& trailer) {
+    const U8* const data[3] = {header.getData(), payload.getData(), trailer.getData()};
+    const U32 sizes[3] = {header.getSize(), payload.getSize(), trailer.getSize()};
+    Drv::SocketIpStatus status = m_socket.send(data, sizes, 3);
+    if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        return SendStatus::SEND_ERROR;
+    }
+    return SendStatus::SEND_OK;
+}
+
 Drv::PollStatus TcpClientComponentImpl::poll_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
     FW_ASSERT(0); // It is an error to call this handler on IP drivers
     return PollStatus::POLL_ERROR;
@@ -132,6 +132,24 @@ class TcpClientComponentImpl : public ByteStreamDriverModelComponentBase, public
      */
     Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
+    /**
+     * \brief Send a header, payload and trailer out of the TcpClient without assembling them
+     *
+     * Gathers the three buffers into one transmission and sends them to the TCP server this component has connected to, avoiding a copy into a single
+     * buffer. Statuses are as for the send port. Unlike the send port, the buffers are not deallocated and remain
+     * owned by the caller.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param header: buffer containing data sent first
+     * \param payload: buffer containing data sent second
+     * \param trailer: buffer containing data sent last
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendGather_handler(const NATIVE_INT_TYPE portNum,
+                                       Fw::Buffer& header,
+                                       Fw::Buffer& payload,
+                                       Fw::Buffer& trailer);
+
     /**
      * \brief **not supported**
      *
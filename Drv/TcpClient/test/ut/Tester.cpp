@@ -77,6 +77,18 @@ void Tester ::test_with_loop(U32 iterations, bool recv_thread) {
             EXPECT_EQ(status2, Drv::SOCK_SUCCESS);
             EXPECT_EQ(size, m_data_buffer.getSize());
             Drv::Test::validate_random_buffer(m_data_buffer, buffer);
+            // Send the same data again gathered from a header, payload and trailer
+            size = sizeof(m_data_storage);
+            const U32 third = m_data_buffer.getSize() / 3;
+            Fw::Buffer header(m_data_storage, third);
+            Fw::Buffer payload(m_data_storage + third, m_data_buffer.getSize() - 2 * third);
+            Fw::Buffer trailer(m_data_storage + m_data_buffer.getSize() - third, third);
+            status = invoke_to_sendGather(0, header, payload, trailer);
+            EXPECT_EQ(status, SendStatus::SEND_OK);
+            status2 = server.recv(buffer, size);
+            EXPECT_EQ(status2, Drv::SOCK_SUCCESS);
+            EXPECT_EQ(size, m_data_buffer.getSize());
+            Drv::Test::validate_random_buffer(m_data_buffer, buffer);
             // If receive thread is live, try the other way
             if (recv_thread) {
                 m_spinner = false;
@@ -188,6 +200,12 @@ Fw::Buffer Tester ::
         this->component.get_send_InputPort(0)
     );
 
+    // sendGather
+    this->connect_to_sendGather(
+        0,
+        this->component.get_sendGather_InputPort(0)
+    );
+
     // poll
     this->connect_to_poll(
         0,
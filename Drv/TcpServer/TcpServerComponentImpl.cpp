@@ -22,7 +22,8 @@ namespace Drv {
 
 TcpServerComponentImpl::TcpServerComponentImpl(const char* const compName)
     : ByteStreamDriverModelComponentBase(compName),
-      SocketReadTask() {}
+      SocketReadTask(),
+      m_multiClient(false) {}
 
 void TcpServerComponentImpl::init(const NATIVE_INT_TYPE instance) {
     ByteStreamDriverModelComponentBase::init(instance);
@@ -31,25 +32,56 @@ void TcpServerComponentImpl::init(const NATIVE_INT_TYPE instance) {
 SocketIpStatus TcpServerComponentImpl::configure(const char* hostname,
                                                  const U16 port,
                                                  const U32 send_timeout_seconds,
-                                                 const U32 send_timeout_microseconds) {
-    return m_socket.configure(hostname, port, send_timeout_seconds, send_timeout_microseconds);
+                                                 const U32 send_timeout_microseconds,
+                                                 const bool multi_client) {
+#ifndef TGT_OS_TYPE_LINUX
+    FW_ASSERT(not multi_client); // Serving multiple clients requires epoll
+#endif
+    m_multiClient = multi_client;
+    return this->getSocketHandler().configure(hostname, port, send_timeout_seconds, send_timeout_microseconds);
 }
 
 TcpServerComponentImpl::~TcpServerComponentImpl() {}
 
 SocketIpStatus TcpServerComponentImpl::startup() {
+#ifdef TGT_OS_TYPE_LINUX
+    if (m_multiClient) {
+        return this->m_multiSocket.startup();
+    }
+#endif
     return  this->m_socket.startup();
 }
 
 void TcpServerComponentImpl::shutdown() {
+#ifdef TGT_OS_TYPE_LINUX
+    if (m_multiClient) {
+        this->m_multiSocket.shutdown();
+        return;
+    }
+#endif
     this->m_socket.shutdown();
 }
 
+#ifdef TGT_OS_TYPE_LINUX
+bool TcpServerComponentImpl::getClientStats(const U32 index, TcpClientStats& stats) {
+    return m_multiClient and m_multiSocket.getClientStats(index, stats);
+}
+
+bool TcpServerComponentImpl::setUplinkClient(const U32 clientId) {
+    return m_multiClient and m_multiSocket.setUplinkClient(clientId);
+}
+#endif
+
 // ----------------------------------------------------------------------
 // Implementations for socket read task virtual methods
 // ----------------------------------------------------------------------
 
 IpSocket& TcpServerComponentImpl::getSocketHandler() {
+#ifdef TGT_OS_TYPE_LINUX
+    if (m_multiClient) {
+        return m_multiSocket;
+    }
+#endif
     return m_socket;
 }
 
@@ -74,7 +106,7 @@ void TcpServerComponentImpl::connected() {
 // ----------------------------------------------------------------------
 
 Drv::SendStatus TcpServerComponentImpl::send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
-    Drv::SocketIpStatus status = m_socket.send(fwBuffer.getData(), fwBuffer.getSize());
+    Drv::SocketIpStatus status = this->getSocketHandler().send(fwBuffer.getData(), fwBuffer.getSize());
     // Always return the buffer
     deallocate_out(0, fwBuffer);
     if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
@@ -85,6 +117,21 @@ Drv::SendStatus TcpServerComponentImpl::send_handler(const NATIVE_INT_TYPE portN
     return SendStatus::SEND_OK;
 }
 
+Drv::SendStatus TcpServerComponentImpl::sendGather_handler(const NATIVE_INT_TYPE portNum,
+                                                           Fw::Buffer& header,
+                                                           Fw::Buffer& payload,
+                                                           Fw::Buffer& trailer) {
+    const U8* const data[3] = {header.getData(), payload.getData(), trailer.getData()};
+    const U32 sizes[3] = {header.getSize(), payload.getSize(), trailer.getSize()};
+    Drv::SocketIpStatus status = this->getSocketHandler().send(data, sizes, 3);
+    if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        return SendStatus::SEND_ERROR;
+    }
+    return SendStatus::SEND_OK;
+}
+
 Drv::PollStatus TcpServerComponentImpl::poll_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
     FW_ASSERT(0); // It is an error to call this handler on IP drivers
     return PollStatus::POLL_ERROR;
@@ -17,6 +17,9 @@
 #include <Drv/Ip/IpSocket.hpp>
 #include <Drv/Ip/SocketReadTask.hpp>
 #include <Drv/Ip/TcpServerSocket.hpp>
+#ifdef TGT_OS_TYPE_LINUX
+#include <Drv/Ip/TcpMultiServerSocket.hpp>
+#endif
 #include "Drv/ByteStreamDriverModel/ByteStreamDriverModelComponentAc.hpp"
 
 namespace Drv {
@@ -62,12 +65,16 @@ class TcpServerComponentImpl : public ByteStreamDriverModelComponentBase, public
      * \param send_timeout_seconds: send timeout seconds component. Defaults to: SOCKET_TIMEOUT_SECONDS
      * \param send_timeout_microseconds: send timeout microseconds component. Must be less than 1000000. Defaults to:
      * SOCKET_TIMEOUT_MICROSECONDS
+     * \param multi_client: serve up to SOCKET_SERVER_MAX_CLIENTS clients at once using Drv::TcpMultiServerSocket.
+     * Sends go to every client and received data from one uplink client is passed to recv. Linux only. Defaults to:
+     * false
      * \return status of the configure
      */
     SocketIpStatus configure(const char* hostname,
                              const U16 port,
                              const U32 send_timeout_seconds = SOCKET_SEND_TIMEOUT_SECONDS,
-                             const U32 send_timeout_microseconds = SOCKET_SEND_TIMEOUT_MICROSECONDS);
+                             const U32 send_timeout_microseconds = SOCKET_SEND_TIMEOUT_MICROSECONDS,
+                             const bool multi_client = false);
     /**
      * \brief startup the TcpServer
      *
@@ -88,6 +95,26 @@ class TcpServerComponentImpl : public ByteStreamDriverModelComponentBase, public
      */
     void shutdown();
 
+#ifdef TGT_OS_TYPE_LINUX
+    /**
+     * \brief get the traffic counters of a client when serving multiple clients
+     *
+     * \param index: client slot index, less than SOCKET_SERVER_MAX_CLIENTS
+     * \param stats: (output) counters of the slot
+     * \return true if the slot holds a connected client, false otherwise or when serving a single client
+     */
+    bool getClientStats(const U32 index, TcpClientStats& stats);
+
+    /**
+     * \brief choose the client whose data is passed to recv when serving multiple clients
+     *
+     * \param clientId: id of the client, as reported by getClientStats
+     * \return true if the client is connected and is now the uplink client, false otherwise or when serving a single
+     * client
+     */
+    bool setUplinkClient(const U32 clientId);
+#endif
+
   PROTECTED:
     // ----------------------------------------------------------------------
     // Implementations for socket read task virtual methods
@@ -152,6 +179,24 @@ class TcpServerComponentImpl : public ByteStreamDriverModelComponentBase, public
      */
     Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
+    /**
+     * \brief Send a header, payload and trailer out of the TcpServer without assembling them
+     *
+     * Gathers the three buffers into one transmission and sends them to the connected TCP client, avoiding a copy into a single
+     * buffer. Statuses are as for the send port. Unlike the send port, the buffers are not deallocated and remain
+     * owned by the caller.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param header: buffer containing data sent first
+     * \param payload: buffer containing data sent second
+     * \param trailer: buffer containing data sent last
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendGather_handler(const NATIVE_INT_TYPE portNum,
+                                       Fw::Buffer& header,
+                                       Fw::Buffer& payload,
+                                       Fw::Buffer& trailer);
+
     /**
      * \brief **not supported**
      *
@@ -160,6 +205,10 @@ class TcpServerComponentImpl : public ByteStreamDriverModelComponentBase, public
     Drv::PollStatus poll_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
     Drv::TcpServerSocket m_socket; //!< Socket implementation
+#ifdef TGT_OS_TYPE_LINUX
+    Drv::TcpMultiServerSocket m_multiSocket; //!< Socket implementation when serving multiple clients
+#endif
+    bool m_multiClient; //!< Serving multiple clients
 };
 
 }  // end namespace Drv
@@ -14,6 +14,8 @@
 #include <IpCfg.hpp>
 #include "Fw/Types/BasicTypes.hpp"
 #include "Fw/Types/Assert.hpp"
+#include "Fw/Logger/Logger.hpp"
+#include <cerrno>
 
 
 namespace Drv {
@@ -24,7 +26,9 @@ namespace Drv {
 
 UdpComponentImpl::UdpComponentImpl(const char* const compName)
     : ByteStreamDriverModelComponentBase(compName),
-      SocketReadTask() {}
+      SocketReadTask(),
+      m_datagramSize(1024),
+      m_batchSize(1) {}
 
 void UdpComponentImpl::init(const NATIVE_INT_TYPE instance) {
     ByteStreamDriverModelComponentBase::init(instance);
@@ -37,7 +41,14 @@ SocketIpStatus UdpComponentImpl::configureSend(const char* hostname,
     return m_socket.configureSend(hostname, port, send_timeout_seconds, send_timeout_microseconds);
 }
 
-SocketIpStatus UdpComponentImpl::configureRecv(const char* hostname, const U16 port) {
+SocketIpStatus UdpComponentImpl::configureRecv(const char* hostname,
+                                                 const U16 port,
+                                                 const U32 datagram_size,
+                                                 const U32 batch_size) {
+    FW_ASSERT(datagram_size > 0);
+    FW_ASSERT((batch_size > 0) && (batch_size <= SOCKET_UDP_MAX_BATCH_SIZE), batch_size);
+    m_datagramSize = datagram_size;
+    m_batchSize = batch_size;
     return m_socket.configureRecv(hostname, port);
 }
 
@@ -52,7 +63,7 @@ IpSocket& UdpComponentImpl::getSocketHandler() {
 }
 
 Fw::Buffer UdpComponentImpl::getBuffer() {
-    return allocate_out(0, 1024);
+    return allocate_out(0, m_datagramSize);
 }
 
 void UdpComponentImpl::sendBuffer(Fw::Buffer buffer, SocketIpStatus status) {
@@ -66,6 +77,55 @@ void UdpComponentImpl::connected() {
     }
 }
 
+SocketIpStatus UdpComponentImpl::readSocket() {
+    if (m_batchSize <= 1) {
+        return SocketReadTask::readSocket();
+    }
+    U8* data[SOCKET_UDP_MAX_BATCH_SIZE];
+    U32 sizes[SOCKET_UDP_MAX_BATCH_SIZE];
+    // Refill only the slots sent out by the previous read, others are still held
+    for (U32 i = 0; i < m_batchSize; i++) {
+        if (m_recvBuffers[i].getData() == nullptr) {
+            m_recvBuffers[i] = this->getBuffer();
+        }
+        data[i] = m_recvBuffers[i].getData();
+        FW_ASSERT(data[i]);
+        sizes[i] = m_recvBuffers[i].getSize();
+    }
+    U32 count = m_batchSize;
+    SocketIpStatus status = m_socket.recvBatch(data, sizes, count);
+    if ((status != SOCK_SUCCESS) && (status != SOCK_INTERRUPTED_TRY_AGAIN)) {
+        Fw::Logger::logMsg("[WARNING] Failed to recv from port with status %d and errno %d\n", status, errno);
+        m_socket.close();
+        // Report the error in the first buffer and return the others
+        m_recvBuffers[0].setSize(0);
+        this->sendBuffer(m_recvBuffers[0], status);
+        m_recvBuffers[0] = Fw::Buffer();
+        this->releaseRecvBuffers();
+        return status;
+    }
+    // Send out received data, the buffers are no longer held
+    for (U32 i = 0; i < count; i++) {
+        m_recvBuffers[i].setSize(sizes[i]);
+        this->sendBuffer(m_recvBuffers[i], status);
+        m_recvBuffers[i] = Fw::Buffer();
+    }
+    return status;
+}
+
+void UdpComponentImpl::readStopped() {
+    this->releaseRecvBuffers();
+}
+
+void UdpComponentImpl::releaseRecvBuffers() {
+    for (U32 i = 0; i < SOCKET_UDP_MAX_BATCH_SIZE; i++) {
+        if (m_recvBuffers[i].getData() != nullptr) {
+            this->deallocate_out(0, m_recvBuffers[i]);
+            m_recvBuffers[i] = Fw::Buffer();
+        }
+    }
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for user-defined typed input ports
 // ----------------------------------------------------------------------
@@ -82,6 +142,44 @@ Drv::SendStatus UdpComponentImpl::send_handler(const NATIVE_INT_TYPE portNum, Fw
     return SendStatus::SEND_OK;
 }
 
+Drv::SendStatus UdpComponentImpl::sendBatch(Fw::Buffer* const buffers, const U32 count) {
+    FW_ASSERT(buffers != nullptr);
+    FW_ASSERT(count <= SOCKET_UDP_MAX_BATCH_SIZE, count);
+    const U8* data[SOCKET_UDP_MAX_BATCH_SIZE];
+    U32 sizes[SOCKET_UDP_MAX_BATCH_SIZE];
+    for (U32 i = 0; i < count; i++) {
+        data[i] = buffers[i].getData();
+        sizes[i] = buffers[i].getSize();
+    }
+    U32 sent = count;
+    Drv::SocketIpStatus status = m_socket.sendBatch(data, sizes, sent);
+    // Always return the buffers
+    for (U32 i = 0; i < count; i++) {
+        deallocate_out(0, buffers[i]);
+    }
+    if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        return SendStatus::SEND_ERROR;
+    }
+    return SendStatus::SEND_OK;
+}
+
+Drv::SendStatus UdpComponentImpl::sendGather_handler(const NATIVE_INT_TYPE portNum,
+                                                     Fw::Buffer& header,
+                                                     Fw::Buffer& payload,
+                                                     Fw::Buffer& trailer) {
+    const U8* const data[3] = {header.getData(), payload.getData(), trailer.getData()};
+    const U32 sizes[3] = {header.getSize(), payload.getSize(), trailer.getSize()};
+    Drv::SocketIpStatus status = m_socket.send(data, sizes, 3);
+    if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        return SendStatus::SEND_ERROR;
+    }
+    return SendStatus::SEND_OK;
+}
+
 Drv::PollStatus UdpComponentImpl::poll_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
     FW_ASSERT(0); // It is an error to call this handler on IP drivers
     return PollStatus::POLL_ERROR;
@@ -75,11 +75,32 @@ class UdpComponentImpl : public ByteStreamDriverModelComponentBase, public Socke
      * source. This call should be performed on system startup before recv or send are called. Note: hostname must be a
      * dot-notation IP address of the form "x.x.x.x". DNS translation is left up to the user.
      *
+     * Datagrams are received into buffers of `datagram_size` bytes from the allocate port. When `batch_size` is greater
+     * than one, the read task holds that many buffers and receives every datagram already waiting, up to `batch_size`,
+     * in a single call (recvmmsg on Linux).
+     *
      * \param hostname: ip address of remote tcp server in the form x.x.x.x
      * \param port: port of remote tcp server
+     * \param datagram_size: size of buffer requested for each datagram. Defaults to: 1024
+     * \param batch_size: datagrams received per call, at most SOCKET_UDP_MAX_BATCH_SIZE. Defaults to: 1
      *  \return status of the configure
      */
-    SocketIpStatus configureRecv(const char* hostname, const U16 port);
+    SocketIpStatus configureRecv(const char* hostname,
+                                 const U16 port,
+                                 const U32 datagram_size = 1024,
+                                 const U32 batch_size = 1);
+
+    /**
+     * \brief send several buffers, one datagram each, in one call
+     *
+     * Sends the buffers as with the send port, using a single sendmmsg call on Linux. Intended for callers draining
+     * several queued buffers at once. Every buffer is returned through the deallocate port.
+     *
+     * \param buffers: buffers to send
+     * \param count: number of buffers, at most SOCKET_UDP_MAX_BATCH_SIZE
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendBatch(Fw::Buffer* const buffers, const U32 count);
 
     /**
      * \brief **not supported**
@@ -128,6 +149,24 @@ class UdpComponentImpl : public ByteStreamDriverModelComponentBase, public Socke
     */
     void connected();
 
+    /**
+     * \brief read one or a batch of datagrams
+     *
+     * Reads a single datagram as the base class does unless a batch size above one was configured, in which case the
+     * empty buffer slots are refilled and every datagram received is sent out.
+     *
+     * \return status of the read
+     */
+    SocketIpStatus readSocket();
+
+    /**
+     * \brief return the buffers held for batched reads
+     *
+     * Called once the read task stops reading. Buffers still held for a batched read are returned through the
+     * deallocate port.
+     */
+    void readStopped();
+
   PRIVATE:
 
     // ----------------------------------------------------------------------
@@ -151,7 +190,33 @@ class UdpComponentImpl : public ByteStreamDriverModelComponentBase, public Socke
      */
     Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
+    /**
+     * \brief Send a header, payload and trailer out of the Udp without assembling them
+     *
+     * Gathers the three buffers into one transmission and sends them as a single datagram to the configured remote port, avoiding a copy into a single
+     * buffer. Statuses are as for the send port. Unlike the send port, the buffers are not deallocated and remain
+     * owned by the caller.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param header: buffer containing data sent first
+     * \param payload: buffer containing data sent second
+     * \param trailer: buffer containing data sent last
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendGather_handler(const NATIVE_INT_TYPE portNum,
+                                       Fw::Buffer& header,
+                                       Fw::Buffer& payload,
+                                       Fw::Buffer& trailer);
+
+    /**
+     * \brief return every buffer held for batched reads through the deallocate port
+     */
+    void releaseRecvBuffers();
+
     Drv::UdpSocket m_socket; //!< Socket implementation
+    U32 m_datagramSize; //!< Size of buffer requested for each datagram
+    U32 m_batchSize; //!< Datagrams received per read
+    Fw::Buffer m_recvBuffers[SOCKET_UDP_MAX_BATCH_SIZE]; //!< Buffers held for batched reads, empty when not held
 };
 
 }  // end namespace Drv
@@ -24,6 +24,26 @@ TEST(Reconnect, ReceiveThreadReconnect) {
     tester.test_advanced_reconnect();
 }
 
+TEST(Batch, RefillsSentBuffers) {
+    Drv::Tester tester;
+    tester.test_batch_refill();
+}
+
+TEST(Batch, ErrorReturnsBuffers) {
+    Drv::Tester tester;
+    tester.test_batch_error();
+}
+
+TEST(Batch, StopReturnsBuffers) {
+    Drv::Tester tester;
+    tester.test_batch_stop();
+}
+
+TEST(Batch, SendBatch) {
+    Drv::Tester tester;
+    tester.test_send_batch();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
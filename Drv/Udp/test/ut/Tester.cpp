@@ -133,6 +133,125 @@ void Tester ::test_advanced_reconnect() {
     test_with_loop(10, true); // Up to 10 * RECONNECT_MS
 }
 
+void Tester ::test_batch_refill() {
+    const U32 batch_size = 4;
+    Drv::UdpSocket udp2;
+    open_batch(udp2, batch_size);
+    // Each read holds a full batch, allocating only for the slots sent out by the read before it
+    U32 sent_out = 0;
+    for (U32 i = 0; i < 3; i++) {
+        m_data_buffer.setSize(sizeof(m_data_storage));
+        Drv::Test::fill_random_buffer(m_data_buffer);
+        ASSERT_EQ(Drv::SOCK_SUCCESS, udp2.send(m_data_buffer.getData(), m_data_buffer.getSize()));
+        ASSERT_EQ(Drv::SOCK_SUCCESS, this->component.readSocket());
+        ASSERT_from_recv_SIZE(i + 1);
+        ASSERT_from_allocate_SIZE(batch_size + sent_out);
+        ASSERT_EQ(this->fromPortHistory_recv->at(i).recvStatus, RecvStatus::RECV_OK);
+        ASSERT_EQ(batch_size - 1, count_held_buffers());
+        sent_out++;
+    }
+    ASSERT_from_deallocate_SIZE(0);
+    this->component.close();
+    this->component.readStopped();
+    ASSERT_from_deallocate_SIZE(batch_size - 1);
+    ASSERT_EQ(0, count_held_buffers());
+    udp2.close();
+}
+
+void Tester ::test_batch_error() {
+    const U32 batch_size = 4;
+    Drv::UdpSocket udp2;
+    open_batch(udp2, batch_size);
+    // Reading the closed socket reports the error in one buffer and returns the others
+    this->component.close();
+    ASSERT_EQ(Drv::SOCK_DISCONNECTED, this->component.readSocket());
+    ASSERT_from_allocate_SIZE(batch_size);
+    ASSERT_from_recv_SIZE(1);
+    ASSERT_EQ(this->fromPortHistory_recv->at(0).recvStatus, RecvStatus::RECV_ERROR);
+    ASSERT_EQ(0, this->fromPortHistory_recv->at(0).recvBuffer.getSize());
+    ASSERT_from_deallocate_SIZE(batch_size - 1);
+    ASSERT_EQ(0, count_held_buffers());
+    udp2.close();
+}
+
+void Tester ::test_batch_stop() {
+    const U32 batch_size = 4;
+    Drv::UdpSocket udp2;
+    open_batch(udp2, batch_size);
+    this->component.close();
+    Os::TaskString name("receiver thread");
+    this->component.startSocketTask(name, true, Os::Task::TASK_DEFAULT, Os::Task::TASK_DEFAULT);
+    EXPECT_TRUE(Drv::Test::wait_on_change(this->component.getSocketHandler(), true, SOCKET_RETRY_INTERVAL_MS/10 + 1));
+    Drv::Test::force_recv_timeout(this->component.getSocketHandler());
+    m_spinner = false;
+    m_data_buffer.setSize(sizeof(m_data_storage));
+    Drv::Test::fill_random_buffer(m_data_buffer);
+    ASSERT_EQ(Drv::SOCK_SUCCESS, udp2.send(m_data_buffer.getData(), m_data_buffer.getSize()));
+    for (U32 i = 0; (i < 1000) && (not m_spinner); i++) {
+        Os::Task::delay(1);
+    }
+    ASSERT_TRUE(m_spinner);
+    this->component.stopSocketTask();
+    ASSERT_EQ(Os::Task::TASK_OK, this->component.joinSocketTask(nullptr));
+    // Every buffer allocated went out through recv or came back through deallocate
+    ASSERT_GE(this->fromPortHistory_allocate->size(), batch_size);
+    ASSERT_EQ(this->fromPortHistory_allocate->size(),
+              this->fromPortHistory_recv->size() + this->fromPortHistory_deallocate->size());
+    ASSERT_EQ(0, count_held_buffers());
+    udp2.close();
+}
+
+void Tester ::test_send_batch() {
+    const U32 count = 3;
+    const U32 size = sizeof(m_data_storage) / count;
+    Drv::UdpSocket udp2;
+    open_batch(udp2, 1);
+    Drv::Test::fill_random_data(m_data_storage, sizeof(m_data_storage));
+    Fw::Buffer buffers[count];
+    for (U32 i = 0; i < count; i++) {
+        buffers[i] = Fw::Buffer(m_data_storage + i * size, size);
+    }
+    // Each buffer arrives as its own datagram and every buffer is returned
+    ASSERT_EQ(this->component.sendBatch(buffers, count), SendStatus::SEND_OK);
+    ASSERT_from_deallocate_SIZE(count);
+    for (U32 i = 0; i < count; i++) {
+        ASSERT_from_deallocate(i, buffers[i]);
+        U8 buffer[sizeof(m_data_storage)];
+        I32 received = sizeof(buffer);
+        ASSERT_EQ(Drv::SOCK_SUCCESS, udp2.recv(buffer, received));
+        ASSERT_EQ(size, static_cast<U32>(received));
+        Drv::Test::validate_random_data(buffer, m_data_storage + i * size, size);
+    }
+    // Buffers are returned even when the batch cannot be sent
+    this->component.close();
+    ASSERT_EQ(this->component.sendBatch(buffers, count), SendStatus::SEND_RETRY);
+    ASSERT_from_deallocate_SIZE(2 * count);
+    udp2.close();
+}
+
+void Tester ::open_batch(Drv::UdpSocket& udp2, U32 batch_size) {
+    U16 port1 = Drv::Test::get_free_port();
+    ASSERT_NE(0, port1);
+    U16 port2 = Drv::Test::get_free_port();
+    ASSERT_NE(0, port2);
+    this->component.configureSend("127.0.0.1", port1, 0, 100);
+    this->component.configureRecv("127.0.0.1", port2, sizeof(m_data_storage), batch_size);
+    ASSERT_EQ(Drv::SOCK_SUCCESS, this->component.open());
+    udp2.configureSend("127.0.0.1", port2, 0, 100);
+    udp2.configureRecv("127.0.0.1", port1);
+    ASSERT_EQ(Drv::SOCK_SUCCESS, udp2.open());
+    Drv::Test::force_recv_timeout(this->component.getSocketHandler());
+    Drv::Test::force_recv_timeout(udp2);
+}
+
+U32 Tester ::count_held_buffers() {
+    U32 held = 0;
+    for (U32 i = 0; i < SOCKET_UDP_MAX_BATCH_SIZE; i++) {
+        held += (this->component.m_recvBuffers[i].getData() != nullptr) ? 1 : 0;
+    }
+    return held;
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
@@ -140,9 +259,11 @@ void Tester ::test_advanced_reconnect() {
 void Tester ::from_recv_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& recvBuffer, const RecvStatus& recvStatus) {
     this->pushFromPortEntry_recv(recvBuffer, recvStatus);
     // Make sure we can get to unblocking the spinner
-    EXPECT_EQ(m_data_buffer.getSize(), recvBuffer.getSize()) << "Invalid transmission size";
-    Drv::Test::validate_random_buffer(m_data_buffer, recvBuffer.getData());
-    m_spinner = true;
+    if (recvStatus == RecvStatus::RECV_OK) {
+        EXPECT_EQ(m_data_buffer.getSize(), recvBuffer.getSize()) << "Invalid transmission size";
+        Drv::Test::validate_random_buffer(m_data_buffer, recvBuffer.getData());
+        m_spinner = true;
+    }
     delete[] recvBuffer.getData();
 }
 
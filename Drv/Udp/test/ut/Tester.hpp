@@ -63,9 +63,31 @@ namespace Drv {
       //!
       void test_advanced_reconnect();
 
+      //! Test batched reads refill only the buffers sent out
+      //!
+      void test_batch_refill();
+
+      //! Test a failed batched read returns every held buffer
+      //!
+      void test_batch_error();
+
+      //! Test stopping the read task returns the held buffers
+      //!
+      void test_batch_stop();
+
+      //! Test sending a batch returns every buffer
+      //!
+      void test_send_batch();
+
       // Helpers
       void test_with_loop(U32 iterations, bool recv_thread=false);
 
+      //! Open the component with the given batch size and a socket sending to and receiving from it
+      void open_batch(Drv::UdpSocket& udp2, U32 batch_size);
+
+      //! Count the buffers the component holds for batched reads
+      U32 count_held_buffers();
+
     private:
 
       // ----------------------------------------------------------------------
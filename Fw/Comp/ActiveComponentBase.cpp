@@ -30,7 +30,7 @@ namespace Fw {
 
     };
 
-    ActiveComponentBase::ActiveComponentBase(const char* name) : QueuedComponentBase(name) {
+    ActiveComponentBase::ActiveComponentBase(const char* name) : QueuedComponentBase(name), m_poolSlot(nullptr) {
 
     }
 
@@ -78,6 +78,14 @@ namespace Fw {
         FW_ASSERT(status == Os::Task::TASK_OK,static_cast<NATIVE_INT_TYPE>(status));
     }
 
+    void ActiveComponentBase::start(ActiveComponentPool& pool) {
+        FW_ASSERT(this->m_poolSlot == nullptr);
+        this->m_poolSlot = pool.add(this);
+        this->m_queue.setSendNotifier(ActiveComponentPool::s_notify, this->m_poolSlot);
+        // Schedule once so the preamble runs on a worker, along with any messages already queued
+        pool.schedule(this->m_poolSlot);
+    }
+
     void ActiveComponentBase::exit() {
         ActiveComponentExitSerializableBuffer exitBuff;
         SerializeStatus stat = exitBuff.serialize(static_cast<I32>(ACTIVE_COMPONENT_EXIT));
@@ -88,6 +96,9 @@ namespace Fw {
 
     Os::Task::TaskStatus ActiveComponentBase::join(void **value_ptr) {
         DEBUG_PRINT("join %s\n", this->getObjName());
+        if (this->m_poolSlot != nullptr) {
+            return this->m_poolSlot->pool->joinComponent(this->m_poolSlot);
+        }
         return this->m_task.join(value_ptr);
     }
 
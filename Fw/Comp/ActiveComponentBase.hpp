@@ -12,6 +12,7 @@
 #define FW_ACTIVE_COMPONENT_BASE_HPP
 
 #include <Fw/Comp/QueuedComponentBase.hpp>
+#include <Fw/Comp/ActiveComponentPool.hpp>
 #include <Os/Task.hpp>
 #include <FpConfig.hpp>
 #include <Fw/Deprecate.hpp>
@@ -23,6 +24,7 @@ namespace Fw {
 
            DEPRECATED(void start(NATIVE_INT_TYPE identifier, NATIVE_INT_TYPE priority, NATIVE_INT_TYPE stackSize, NATIVE_INT_TYPE cpuAffinity = -1),
                       "Please switch to start(NATIVE_UINT_TYPE priority, NATIVE_UINT_TYPE stackSize, NATIVE_UINT_TYPE cpuAffinity, NATIVE_UINT_TYPE identifier)"); //!< called by instantiator when task is to be started
+            void start(ActiveComponentPool& pool); //!< called by instantiator to run the component on the worker threads of a started pool instead of its own task
             void exit(); //!< exit task in active component
             Os::Task::TaskStatus join(void **value_ptr); //!< provide return value of thread if value_ptr is not NULL
 
@@ -42,6 +44,8 @@ namespace Fw {
             virtual void toString(char* str, NATIVE_INT_TYPE size); //!< create string description of component
 #endif
         PRIVATE:
+            friend class ActiveComponentPool;
+            ActiveComponentPool::Slot* m_poolSlot; //!< place in the pool running the component, if started on a pool
             static void s_baseTask(void*); //!< function provided to task class for new thread.
             static void s_baseBareTask(void*); //!< function provided to task class for new thread.
     };
@@ -0,0 +1,250 @@
+// ======================================================================
+// \title  ActiveComponentPool.cpp
+// \brief  Runs active components on a fixed set of worker threads
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Comp/ActiveComponentPool.hpp>
+#include <Fw/Comp/ActiveComponentBase.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <Os/QueueString.hpp>
+#include <Os/TaskString.hpp>
+#include <cstdio>
+
+namespace Fw {
+
+    // How often a component join checks whether the component has exited
+    static const NATIVE_UINT_TYPE JOIN_POLL_MS = 1;
+
+    ActiveComponentPool::ActiveComponentPool() :
+        m_numWorkers(0),
+        m_numSlots(0),
+        m_nextWorker(0),
+        m_sleepers(0),
+        m_running(false)
+    {
+        for (NATIVE_UINT_TYPE i = 0; i < FW_ACTIVE_COMPONENT_POOL_MAX_WORKERS; i++) {
+            this->m_workers[i].pool = this;
+            this->m_workers[i].index = i;
+            this->m_workers[i].head = 0;
+            this->m_workers[i].count = 0;
+        }
+        for (NATIVE_UINT_TYPE i = 0; i < FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS; i++) {
+            this->m_slots[i].component = nullptr;
+            this->m_slots[i].pool = this;
+            this->m_slots[i].scheduled = false;
+            this->m_slots[i].exited = false;
+            this->m_slots[i].started = false;
+        }
+    }
+
+    ActiveComponentPool::~ActiveComponentPool() {
+    }
+
+    void ActiveComponentPool::start(NATIVE_UINT_TYPE numWorkers, NATIVE_UINT_TYPE priority, NATIVE_UINT_TYPE stackSize, NATIVE_UINT_TYPE cpuAffinity) {
+        FW_ASSERT(numWorkers > 0 && numWorkers <= FW_ACTIVE_COMPONENT_POOL_MAX_WORKERS, numWorkers);
+        FW_ASSERT(this->m_numWorkers == 0, this->m_numWorkers);
+
+        // One wake-up token per worker is enough to wake every worker
+        Os::QueueString queueName("ActPoolWake");
+        Os::Queue::QueueStatus qStat = this->m_wakeQueue.create(queueName, static_cast<NATIVE_INT_TYPE>(numWorkers), sizeof(U8));
+        FW_ASSERT(Os::Queue::QUEUE_OK == qStat, static_cast<NATIVE_INT_TYPE>(qStat));
+
+        this->m_running = true;
+        this->m_numWorkers = numWorkers;
+        for (NATIVE_UINT_TYPE i = 0; i < numWorkers; i++) {
+            char taskNameChar[FW_TASK_NAME_MAX_SIZE];
+            (void)snprintf(taskNameChar, sizeof(taskNameChar), "ActPool_%u", i);
+            Os::TaskString taskName(taskNameChar);
+            Os::Task::TaskStatus status = this->m_workers[i].task.start(taskName, s_workerTask, &this->m_workers[i], priority, stackSize, cpuAffinity);
+            FW_ASSERT(status == Os::Task::TASK_OK, static_cast<NATIVE_INT_TYPE>(status));
+        }
+    }
+
+    void ActiveComponentPool::exit() {
+        this->m_running = false;
+        for (NATIVE_UINT_TYPE i = 0; i < this->m_numWorkers; i++) {
+            // A full queue already holds a token for every worker
+            U8 token = 0;
+            (void)this->m_wakeQueue.send(&token, sizeof(token), 0, Os::Queue::QUEUE_NONBLOCKING);
+        }
+    }
+
+    Os::Task::TaskStatus ActiveComponentPool::join() {
+        for (NATIVE_UINT_TYPE i = 0; i < this->m_numWorkers; i++) {
+            Os::Task::TaskStatus status = this->m_workers[i].task.join(nullptr);
+            if (status != Os::Task::TASK_OK) {
+                return status;
+            }
+        }
+        return Os::Task::TASK_OK;
+    }
+
+    ActiveComponentPool::Slot* ActiveComponentPool::add(ActiveComponentBase* component) {
+        FW_ASSERT(component != nullptr);
+        FW_ASSERT(this->m_numWorkers > 0);
+        this->m_slotLock.lock();
+        FW_ASSERT(this->m_numSlots < FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS, this->m_numSlots);
+        Slot* slot = &this->m_slots[this->m_numSlots];
+        this->m_numSlots++;
+        this->m_slotLock.unLock();
+        slot->component = component;
+        return slot;
+    }
+
+    void ActiveComponentPool::schedule(Slot* slot) {
+        bool expected = false;
+        if (!slot->scheduled.compare_exchange_strong(expected, true)) {
+            // Already on a deque, or being run by a worker that will look at the queue again before it lets go
+            return;
+        }
+        const NATIVE_UINT_TYPE index = this->m_nextWorker.fetch_add(1) % this->m_numWorkers;
+        this->pushBack(this->m_workers[index], slot);
+        this->wake();
+    }
+
+    Os::Task::TaskStatus ActiveComponentPool::joinComponent(Slot* slot) {
+        while (!slot->exited) {
+            (void)Os::Task::delay(JOIN_POLL_MS);
+        }
+        return Os::Task::TASK_OK;
+    }
+
+    void ActiveComponentPool::wake() {
+        // A worker counts itself as a sleeper before its last look at the deques, so a component pushed before this
+        // check is either seen by that look or the worker is woken here
+        if (this->m_sleepers > 0) {
+            U8 token = 0;
+            (void)this->m_wakeQueue.send(&token, sizeof(token), 0, Os::Queue::QUEUE_NONBLOCKING);
+        }
+    }
+
+    void ActiveComponentPool::pushBack(Worker& worker, Slot* slot) {
+        worker.lock.lock();
+        // Each component is on at most one deque, so a deque can always hold every component
+        FW_ASSERT(worker.count < FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS, worker.count);
+        worker.deque[(worker.head + worker.count) % FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS] = slot;
+        worker.count++;
+        worker.lock.unLock();
+    }
+
+    void ActiveComponentPool::pushFront(Worker& worker, Slot* slot) {
+        worker.lock.lock();
+        FW_ASSERT(worker.count < FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS, worker.count);
+        worker.head = (worker.head + FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS - 1) % FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS;
+        worker.deque[worker.head] = slot;
+        worker.count++;
+        worker.lock.unLock();
+    }
+
+    ActiveComponentPool::Slot* ActiveComponentPool::popBack(Worker& worker) {
+        Slot* slot = nullptr;
+        worker.lock.lock();
+        if (worker.count > 0) {
+            worker.count--;
+            slot = worker.deque[(worker.head + worker.count) % FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS];
+        }
+        worker.lock.unLock();
+        return slot;
+    }
+
+    ActiveComponentPool::Slot* ActiveComponentPool::popFront(Worker& worker) {
+        Slot* slot = nullptr;
+        worker.lock.lock();
+        if (worker.count > 0) {
+            slot = worker.deque[worker.head];
+            worker.head = (worker.head + 1) % FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS;
+            worker.count--;
+        }
+        worker.lock.unLock();
+        return slot;
+    }
+
+    ActiveComponentPool::Slot* ActiveComponentPool::findWork(Worker& worker) {
+        // Newest first from our own deque, since its messages are most likely still in cache
+        Slot* slot = this->popBack(worker);
+        // Oldest first from the others
+        for (NATIVE_UINT_TYPE i = 1; slot == nullptr && i < this->m_numWorkers; i++) {
+            slot = this->popFront(this->m_workers[(worker.index + i) % this->m_numWorkers]);
+        }
+        return slot;
+    }
+
+    void ActiveComponentPool::run(Worker& worker, Slot* slot) {
+        ActiveComponentBase* comp = slot->component;
+        if (!slot->started) {
+            slot->started = true;
+            comp->preamble();
+        }
+        for (NATIVE_UINT_TYPE i = 0; i < FW_ACTIVE_COMPONENT_POOL_DISPATCH_LIMIT; i++) {
+            if (comp->m_queue.getNumMsgs() == 0) {
+                // Let go of the component, then look again: a message sent before the flag was cleared did not
+                // schedule it
+                slot->scheduled = false;
+                if (comp->m_queue.getNumMsgs() > 0) {
+                    this->schedule(slot);
+                }
+                return;
+            }
+            // Only this worker receives from the queue while it holds the component, so the receive in
+            // doDispatch will not block
+            ActiveComponentBase::MsgDispatchStatus loopStatus = comp->doDispatch();
+            switch (loopStatus) {
+                case ActiveComponentBase::MSG_DISPATCH_OK: // if normal message processing, continue
+                    break;
+                case ActiveComponentBase::MSG_DISPATCH_EXIT:
+                    // Never let go of an exited component, so it is not scheduled again
+                    comp->finalizer();
+                    slot->exited = true;
+                    return;
+                default:
+                    FW_ASSERT(0, static_cast<NATIVE_INT_TYPE>(loopStatus));
+            }
+        }
+        // Out of turns: keep the component, but behind everything else on this worker's deque
+        this->pushFront(worker, slot);
+        this->wake();
+    }
+
+    void ActiveComponentPool::work(Worker& worker) {
+        while (this->m_running) {
+            Slot* slot = this->findWork(worker);
+            if (slot == nullptr) {
+                // Count ourselves as a sleeper before the last look, so a component scheduled from here on
+                // sends a wake-up token
+                this->m_sleepers++;
+                slot = this->findWork(worker);
+                if (slot == nullptr && this->m_running) {
+                    U8 token = 0;
+                    NATIVE_INT_TYPE size = 0;
+                    NATIVE_INT_TYPE priority = 0;
+                    Os::Queue::QueueStatus status = this->m_wakeQueue.receive(&token, sizeof(token), size, priority, Os::Queue::QUEUE_BLOCKING);
+                    FW_ASSERT(Os::Queue::QUEUE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+                }
+                this->m_sleepers--;
+            }
+            if (slot != nullptr) {
+                this->run(worker, slot);
+            }
+        }
+    }
+
+    void ActiveComponentPool::s_workerTask(void* ptr) {
+        FW_ASSERT(ptr != nullptr);
+        Worker* worker = static_cast<Worker*>(ptr);
+        worker->task.setStarted(true);
+        worker->pool->work(*worker);
+    }
+
+    void ActiveComponentPool::s_notify(void* ptr) {
+        FW_ASSERT(ptr != nullptr);
+        Slot* slot = static_cast<Slot*>(ptr);
+        slot->pool->schedule(slot);
+    }
+
+}
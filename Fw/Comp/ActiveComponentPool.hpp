@@ -0,0 +1,100 @@
+// ======================================================================
+// \title  ActiveComponentPool.hpp
+// \brief  Runs active components on a fixed set of worker threads
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef FW_ACTIVE_COMPONENT_POOL_HPP
+#define FW_ACTIVE_COMPONENT_POOL_HPP
+
+#include <FpConfig.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+#include <Os/Mutex.hpp>
+#include <Os/Queue.hpp>
+#include <Os/Task.hpp>
+
+#include <atomic>
+
+namespace Fw {
+
+    class ActiveComponentBase;
+
+    //! \class ActiveComponentPool
+    //! \brief Runs active components as tasks on a fixed set of worker threads
+    //!
+    //! A component started on a pool has no thread of its own. When a message is sent to an idle component, the
+    //! component is pushed onto the deque of one of the workers. A worker takes components from the back of its own
+    //! deque and, when that is empty, steals from the front of the other workers' deques. A component is on at most
+    //! one deque and is run by at most one worker at a time, so its messages are dispatched one at a time in the
+    //! order its queue returns them, as they would be on its own thread. Workers with nothing to do block on a
+    //! wake-up queue. A handler that blocks, for instance on a full queue, holds its worker until it returns, so
+    //! components that wait on each other need more workers than waiters.
+    class ActiveComponentPool {
+        public:
+            ActiveComponentPool(); //!< Constructor
+            ~ActiveComponentPool(); //!< Destructor
+
+            //! Start the worker threads. Must be called before any component is started on the pool.
+            //! \param numWorkers: number of worker threads, at most FW_ACTIVE_COMPONENT_POOL_MAX_WORKERS
+            //! \param priority: priority of each worker thread
+            //! \param stackSize: stack size of each worker thread
+            //! \param cpuAffinity: cpu affinity of each worker thread
+            void start(NATIVE_UINT_TYPE numWorkers, NATIVE_UINT_TYPE priority = Os::Task::TASK_DEFAULT, NATIVE_UINT_TYPE stackSize = Os::Task::TASK_DEFAULT, NATIVE_UINT_TYPE cpuAffinity = Os::Task::TASK_DEFAULT);
+            void exit(); //!< stop the worker threads. Components on the pool should be exited and joined first
+            Os::Task::TaskStatus join(); //!< wait for the worker threads to stop
+
+        PRIVATE:
+            friend class ActiveComponentBase;
+
+            //! A component started on the pool
+            struct Slot {
+                ActiveComponentBase* component; //!< the component
+                ActiveComponentPool* pool; //!< the pool running the component
+                std::atomic<bool> scheduled; //!< set while the component is on a deque or being run
+                std::atomic<bool> exited; //!< set once the component has handled its exit message
+                bool started; //!< set once the component preamble has run
+            };
+
+            //! A worker thread and its deque of ready components
+            struct Worker {
+                Os::Task task; //!< the worker thread
+                ActiveComponentPool* pool; //!< the pool owning the worker
+                NATIVE_UINT_TYPE index; //!< index of the worker in the pool
+                Os::Mutex lock; //!< guards the deque
+                Slot* deque[FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS]; //!< ring of ready components
+                NATIVE_UINT_TYPE head; //!< ring index of the front of the deque
+                NATIVE_UINT_TYPE count; //!< number of components on the deque
+            };
+
+            Slot* add(ActiveComponentBase* component); //!< add a component to the pool
+            void schedule(Slot* slot); //!< put a component on a deque unless it is already on one or being run
+            Os::Task::TaskStatus joinComponent(Slot* slot); //!< wait for a component to handle its exit message
+            void wake(); //!< wake a sleeping worker, if there is one
+            void pushBack(Worker& worker, Slot* slot); //!< push a component onto the back of a deque
+            void pushFront(Worker& worker, Slot* slot); //!< push a component onto the front of a deque
+            Slot* popBack(Worker& worker); //!< pop a component from the back of a deque, or nullptr if empty
+            Slot* popFront(Worker& worker); //!< pop a component from the front of a deque, or nullptr if empty
+            Slot* findWork(Worker& worker); //!< pop from the worker's own deque, or steal from another
+            void run(Worker& worker, Slot* slot); //!< dispatch messages for one component
+            void work(Worker& worker); //!< worker thread loop
+            static void s_workerTask(void* ptr); //!< function provided to task class for each worker thread
+            static void s_notify(void* ptr); //!< send notifier set on the queue of each component
+
+            Worker m_workers[FW_ACTIVE_COMPONENT_POOL_MAX_WORKERS]; //!< the workers
+            NATIVE_UINT_TYPE m_numWorkers; //!< number of workers started
+            Slot m_slots[FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS]; //!< the components
+            NATIVE_UINT_TYPE m_numSlots; //!< number of components added
+            Os::Mutex m_slotLock; //!< guards adding components
+            std::atomic<NATIVE_UINT_TYPE> m_nextWorker; //!< next worker to receive a newly ready component
+            std::atomic<NATIVE_UINT_TYPE> m_sleepers; //!< number of workers going to sleep or asleep
+            std::atomic<bool> m_running; //!< cleared to stop the workers
+            Os::Queue m_wakeQueue; //!< queue sleeping workers block on
+    };
+
+}
+#endif
@@ -0,0 +1,79 @@
+// ======================================================================
+// \title  ActiveComponentPoolBenchmark.cpp
+// \brief  Compares a thread per active component with a pool of workers
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Comp/ActiveComponentPool.hpp>
+#include <Fw/Comp/test/ut/ChainComponent.hpp>
+
+#include <sys/resource.h>
+#include <cstdio>
+
+using namespace ActiveComponentPoolTest;
+
+namespace {
+
+    U64 contextSwitches() {
+        struct rusage usage;
+        (void)getrusage(RUSAGE_SELF, &usage);
+        return static_cast<U64>(usage.ru_nvcsw) + static_cast<U64>(usage.ru_nivcsw);
+    }
+
+    //! Time bursts that hit every chain at once
+    void runBursts(ChainComponent* components, const char* mode) {
+        const U32 bursts = 2000;
+        const U64 startSwitches = contextSwitches();
+        const U64 startNs = now();
+        for (U32 burst = 0; burst < bursts; burst++) {
+            runChains(components, burst, 1);
+        }
+        const U64 elapsedNs = now() - startNs;
+        const U64 switches = contextSwitches() - startSwitches;
+        U64 latencyNs = 0;
+        for (U32 chain = 0; chain < CHAINS; chain++) {
+            latencyNs += components[chain * CHAIN_LENGTH + CHAIN_LENGTH - 1].latencyNs;
+        }
+        printf("%28s %14.1f %14.1f %16.1f\n", mode,
+               static_cast<F64>(latencyNs) / (bursts * CHAINS) / 1000.0,
+               static_cast<F64>(elapsedNs) / bursts / 1000.0,
+               static_cast<F64>(switches) / bursts);
+    }
+
+}
+
+// Reports the latency from sending a value to the head of each chain until the
+// tail handles it, and the context switches per burst, for a thread per
+// component and for a pool of workers
+int main(int argc, char* argv[]) {
+    printf("%28s %14s %14s %16s\n", "mode", "latency (us)", "burst (us)", "switches/burst");
+    {
+        ChainComponent components[NUM_COMPONENTS];
+        initChains(components, 4);
+        for (U32 i = 0; i < NUM_COMPONENTS; i++) {
+            components[i].start();
+        }
+        runBursts(components, "thread per component");
+        exitAll(components);
+    }
+    {
+        Fw::ActiveComponentPool pool;
+        pool.start(NUM_WORKERS);
+        ChainComponent components[NUM_COMPONENTS];
+        initChains(components, 4);
+        for (U32 i = 0; i < NUM_COMPONENTS; i++) {
+            components[i].start(pool);
+        }
+        runBursts(components, "pool of 4 workers");
+        exitAll(components);
+        pool.exit();
+        const Os::Task::TaskStatus status = pool.join();
+        FW_ASSERT(Os::Task::TASK_OK == status, status);
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+// ======================================================================
+// \title  ActiveComponentPoolTest.cpp
+// \brief  Tests for running active components on a pool of worker threads
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Fw/Comp/ActiveComponentPool.hpp>
+#include <Fw/Comp/test/ut/ChainComponent.hpp>
+#include <gtest/gtest.h>
+
+using namespace ActiveComponentPoolTest;
+
+TEST(ActiveComponentPool, KeepsOrderPerComponent) {
+    const U32 values = 2000;
+    Fw::ActiveComponentPool pool;
+    pool.start(NUM_WORKERS);
+    ChainComponent components[NUM_COMPONENTS];
+    initChains(components, values + 1);
+    for (U32 i = 0; i < NUM_COMPONENTS; i++) {
+        components[i].start(pool);
+    }
+
+    runChains(components, 0, values);
+    exitAll(components);
+    for (U32 i = 0; i < NUM_COMPONENTS; i++) {
+        ASSERT_EQ(values, components[i].received);
+        ASSERT_EQ(0U, components[i].outOfOrder);
+        ASSERT_EQ(0U, components[i].overlaps);
+        ASSERT_EQ(1U, components[i].preambles);
+        ASSERT_EQ(1U, components[i].finalizers);
+    }
+    pool.exit();
+    ASSERT_EQ(Os::Task::TASK_OK, pool.join());
+}
+
+TEST(ActiveComponentPool, RunsMessagesQueuedBeforeStart) {
+    Fw::ActiveComponentPool pool;
+    pool.start(1);
+    ChainComponent components[NUM_COMPONENTS];
+    initChains(components, 4);
+    components[CHAIN_LENGTH - 1].send(0, now());
+    components[CHAIN_LENGTH - 1].start(pool);
+    while (components[CHAIN_LENGTH - 1].received < 1) {
+    }
+    components[CHAIN_LENGTH - 1].exit();
+    ASSERT_EQ(Os::Task::TASK_OK, components[CHAIN_LENGTH - 1].join(nullptr));
+    ASSERT_EQ(1U, components[CHAIN_LENGTH - 1].preambles);
+    ASSERT_EQ(1U, components[CHAIN_LENGTH - 1].finalizers);
+    pool.exit();
+    ASSERT_EQ(Os::Task::TASK_OK, pool.join());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,179 @@
+// ======================================================================
+// \title  ChainComponent.hpp
+// \brief  Chains of active components shared by the pool tests and benchmark
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef FW_COMP_TEST_CHAIN_COMPONENT_HPP
+#define FW_COMP_TEST_CHAIN_COMPONENT_HPP
+
+#include <Fw/Comp/ActiveComponentBase.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#include <atomic>
+#include <chrono>
+
+namespace ActiveComponentPoolTest {
+
+    enum {
+        MSG_VALUE = Fw::ActiveComponentBase::ACTIVE_COMPONENT_EXIT + 1
+    };
+
+    const U32 CHAINS = 8; //!< number of independent chains of components
+    const U32 CHAIN_LENGTH = 8; //!< number of components in each chain
+    const U32 NUM_COMPONENTS = CHAINS * CHAIN_LENGTH;
+    const U32 NUM_WORKERS = 4;
+
+    inline U64 now() {
+        return static_cast<U64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    class MsgBuffer : public Fw::SerializeBufferBase {
+        public:
+            NATIVE_UINT_TYPE getBuffCapacity() const {
+                return sizeof(m_buff);
+            }
+
+            U8* getBuffAddr() {
+                return m_buff;
+            }
+
+            const U8* getBuffAddr() const {
+                return m_buff;
+            }
+
+        private:
+            U8 m_buff[sizeof(I32) + sizeof(U32) + sizeof(U64)];
+    };
+
+    //! An active component that checks each value it receives is one more
+    //! than the last, then passes it to the next component in its chain.
+    //! The last component in a chain records the time since the value was
+    //! first sent.
+    class ChainComponent : public Fw::ActiveComponentBase {
+        public:
+            ChainComponent() :
+                ActiveComponentBase("Chain"),
+                next(nullptr),
+                received(0),
+                outOfOrder(0),
+                overlaps(0),
+                preambles(0),
+                finalizers(0),
+                latencyNs(0),
+                m_expected(0),
+                m_busy(false)
+            {
+            }
+
+            void init(NATIVE_INT_TYPE queueDepth) {
+                ActiveComponentBase::init(0);
+                Os::Queue::QueueStatus status = this->createQueue(queueDepth, sizeof(I32) + sizeof(U32) + sizeof(U64));
+                FW_ASSERT(Os::Queue::QUEUE_OK == status, status);
+            }
+
+            void send(U32 value, U64 sentNs) {
+                MsgBuffer msg;
+                FW_ASSERT(msg.serialize(static_cast<I32>(MSG_VALUE)) == Fw::FW_SERIALIZE_OK);
+                FW_ASSERT(msg.serialize(value) == Fw::FW_SERIALIZE_OK);
+                FW_ASSERT(msg.serialize(sentNs) == Fw::FW_SERIALIZE_OK);
+                Os::Queue::QueueStatus status = this->m_queue.send(msg, 0, Os::Queue::QUEUE_NONBLOCKING);
+                FW_ASSERT(Os::Queue::QUEUE_OK == status, status);
+            }
+
+            ChainComponent* next;
+            std::atomic<U32> received;
+            U32 outOfOrder;
+            U32 overlaps;
+            U32 preambles;
+            U32 finalizers;
+            U64 latencyNs;
+
+        PROTECTED:
+            MsgDispatchStatus doDispatch() {
+                MsgBuffer msg;
+                NATIVE_INT_TYPE priority = 0;
+                Os::Queue::QueueStatus status = this->m_queue.receive(msg, priority, Os::Queue::QUEUE_BLOCKING);
+                FW_ASSERT(Os::Queue::QUEUE_OK == status, status);
+                I32 msgType = 0;
+                FW_ASSERT(msg.deserialize(msgType) == Fw::FW_SERIALIZE_OK);
+                if (msgType == ACTIVE_COMPONENT_EXIT) {
+                    return MSG_DISPATCH_EXIT;
+                }
+                U32 value = 0;
+                U64 sentNs = 0;
+                FW_ASSERT(msg.deserialize(value) == Fw::FW_SERIALIZE_OK);
+                FW_ASSERT(msg.deserialize(sentNs) == Fw::FW_SERIALIZE_OK);
+
+                // A pool must never run the same component on two workers at once
+                if (this->m_busy.exchange(true)) {
+                    this->overlaps++;
+                }
+                if (value != this->m_expected) {
+                    this->outOfOrder++;
+                }
+                this->m_expected = value + 1;
+                if (this->next != nullptr) {
+                    this->next->send(value, sentNs);
+                } else {
+                    this->latencyNs += now() - sentNs;
+                }
+                this->m_busy = false;
+                this->received++;
+                return MSG_DISPATCH_OK;
+            }
+
+            void preamble() {
+                this->preambles++;
+            }
+
+            void finalizer() {
+                this->finalizers++;
+            }
+
+        PRIVATE:
+            U32 m_expected;
+            std::atomic<bool> m_busy;
+    };
+
+    //! Link components into chains and create their queues
+    inline void initChains(ChainComponent* components, NATIVE_INT_TYPE queueDepth) {
+        for (U32 i = 0; i < NUM_COMPONENTS; i++) {
+            components[i].init(queueDepth);
+            components[i].next = ((i + 1) % CHAIN_LENGTH == 0) ? nullptr : &components[i + 1];
+        }
+    }
+
+    //! Send values to the head of every chain, then wait for the tails to see them
+    inline void runChains(ChainComponent* components, U32 firstValue, U32 values) {
+        for (U32 value = firstValue; value < firstValue + values; value++) {
+            for (U32 chain = 0; chain < CHAINS; chain++) {
+                components[chain * CHAIN_LENGTH].send(value, now());
+            }
+        }
+        for (U32 chain = 0; chain < CHAINS; chain++) {
+            while (components[chain * CHAIN_LENGTH + CHAIN_LENGTH - 1].received < firstValue + values) {
+            }
+        }
+    }
+
+    //! Stop every component and wait for it to finish
+    inline void exitAll(ChainComponent* components) {
+        for (U32 i = 0; i < NUM_COMPONENTS; i++) {
+            components[i].exit();
+        }
+        for (U32 i = 0; i < NUM_COMPONENTS; i++) {
+            const Os::Task::TaskStatus status = components[i].join(nullptr);
+            FW_ASSERT(Os::Task::TASK_OK == status, status);
+        }
+    }
+
+}
+
+#endif
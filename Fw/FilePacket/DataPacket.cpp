@@ -49,6 +49,13 @@ namespace Fw {
     return this->toSerialBuffer(serialBuffer);
   }
 
+  U8* FilePacket::DataPacket ::
+    getDataAddress(Buffer& buffer)
+  {
+    FW_ASSERT(buffer.getSize() >= HEADERSIZE, buffer.getSize());
+    return &buffer.getData()[HEADERSIZE];
+  }
+
   SerializeStatus FilePacket::DataPacket ::
     fromSerialBuffer(SerialBuffer& serialBuffer)
   {
@@ -102,7 +109,13 @@ namespace Fw {
     if (status != FW_SERIALIZE_OK)
       return status;
 
-    status = serialBuffer.pushBytes(this->data, dataSize);
+    // The data may already be in place, e.g., read straight into the buffer
+    if (this->data == serialBuffer.getBuffAddrSer()) {
+      status = serialBuffer.setBuffLen(serialBuffer.getBuffLength() + dataSize);
+    }
+    else {
+      status = serialBuffer.pushBytes(this->data, dataSize);
+    }
 
     return status;
 
@@ -199,6 +199,10 @@ namespace Fw {
           //! Convert this DataPacket to a Buffer
           SerializeStatus toBuffer(Buffer& buffer) const;
 
+          //! Get the address of the file data in a buffer holding a DataPacket.
+          //! Data placed there in advance is not copied by toBuffer.
+          static U8* getDataAddress(Buffer& buffer);
+
         PRIVATE:
 
           //! Initialize this DataPacket from a SerialBuffer
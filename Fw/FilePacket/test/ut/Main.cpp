@@ -103,6 +103,48 @@ namespace Fw {
     );
   }
 
+  // Serialize a data packet whose data is already in the buffer
+  TEST(FilePacket, DataPacketInPlace) {
+    const U32 dataSize = 10;
+    const U32 size = FilePacket::DataPacket::HEADERSIZE + dataSize;
+    U8 bytes[size];
+    Buffer buffer(bytes, size);
+    U8 *const data = FilePacket::DataPacket::getDataAddress(buffer);
+    for (U32 i = 0; i < dataSize; ++i) {
+      data[i] = static_cast<U8>(i);
+    }
+    FilePacket::DataPacket expected;
+    expected.initialize(
+        3, // Sequence index
+        42, // Byte offset
+        dataSize, // Data size
+        data // Data
+    );
+    ASSERT_EQ(size, expected.bufferSize());
+    {
+      const SerializeStatus status =
+        expected.toBuffer(buffer);
+      ASSERT_EQ(status, FW_SERIALIZE_OK);
+    }
+    FilePacket actual;
+    {
+      const SerializeStatus status =
+        actual.fromBuffer(buffer);
+      ASSERT_EQ(status, FW_SERIALIZE_OK);
+    }
+    const FilePacket::DataPacket& actualDataPacket =
+      actual.asDataPacket();
+    ASSERT_EQ(data, actualDataPacket.data);
+    GTest::FilePackets::DataPacket::compare(
+        expected,
+        actualDataPacket
+    );
+    // The data did not move
+    for (U32 i = 0; i < dataSize; ++i) {
+      ASSERT_EQ(i, data[i]);
+    }
+  }
+
   // Serialize and deserialize an end packet
   TEST(FilePacket, EndPacket) {
     FilePacket::EndPacket expected;
@@ -10,7 +10,7 @@
 
 namespace Fw {
 
-    TlmPacket::TlmPacket() : m_id(0) {
+    TlmPacket::TlmPacket() : m_id(0), m_pktBuffer(nullptr), m_numEntries(0) {
         this->m_type = FW_PACKET_TELEM;
     }
 
@@ -97,4 +97,90 @@ namespace Fw {
         return this->m_tlmBuffer;
     }
 
+    void TlmPacket::setBuffer(ComBuffer& buffer) {
+        this->m_pktBuffer = &buffer;
+    }
+
+    SerializeStatus TlmPacket::resetPktSer() {
+        FW_ASSERT(this->m_pktBuffer != nullptr);
+        this->m_pktBuffer->resetSer();
+        this->m_numEntries = 0;
+#if !FW_AMPCS_COMPATIBLE
+        return this->serializeBase(*this->m_pktBuffer);
+#else
+        return FW_SERIALIZE_OK;
+#endif
+    }
+
+    SerializeStatus TlmPacket::addValue(FwChanIdType id, Time& timeTag, TlmBuffer& buffer) {
+        FW_ASSERT(this->m_pktBuffer != nullptr);
+        // check for room first so a value that doesn't fit leaves the packet intact
+        NATIVE_UINT_TYPE size = sizeof(FwChanIdType) + buffer.getBuffLength();
+#if !FW_AMPCS_COMPATIBLE
+        size += Time::SERIALIZED_SIZE;
+#endif
+        if (size > this->m_pktBuffer->getBuffCapacity() - this->m_pktBuffer->getBuffLength()) {
+            return FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+
+        SerializeStatus stat = this->m_pktBuffer->serialize(id);
+        FW_ASSERT(stat == FW_SERIALIZE_OK,static_cast<NATIVE_INT_TYPE>(stat));
+#if !FW_AMPCS_COMPATIBLE
+        stat = this->m_pktBuffer->serialize(timeTag);
+        FW_ASSERT(stat == FW_SERIALIZE_OK,static_cast<NATIVE_INT_TYPE>(stat));
+#endif
+        stat = this->m_pktBuffer->serialize(buffer.getBuffAddr(),buffer.getBuffLength(),true);
+        FW_ASSERT(stat == FW_SERIALIZE_OK,static_cast<NATIVE_INT_TYPE>(stat));
+        this->m_numEntries++;
+        return FW_SERIALIZE_OK;
+    }
+
+    ComBuffer& TlmPacket::getBuffer() {
+        FW_ASSERT(this->m_pktBuffer != nullptr);
+        return *this->m_pktBuffer;
+    }
+
+    NATIVE_UINT_TYPE TlmPacket::getNumEntries() const {
+        return this->m_numEntries;
+    }
+
+    SerializeStatus TlmPacket::resetPktDeser() {
+        FW_ASSERT(this->m_pktBuffer != nullptr);
+        this->m_pktBuffer->resetDeser();
+#if !FW_AMPCS_COMPATIBLE
+        SerializeStatus stat = this->deserializeBase(*this->m_pktBuffer);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+        if (this->m_type != FW_PACKET_TELEM) {
+            return FW_DESERIALIZE_TYPE_MISMATCH;
+        }
+#endif
+        return FW_SERIALIZE_OK;
+    }
+
+    SerializeStatus TlmPacket::extractValue(FwChanIdType &id, Time& timeTag, TlmBuffer& buffer, NATIVE_UINT_TYPE bufferSize) {
+        FW_ASSERT(this->m_pktBuffer != nullptr);
+        SerializeStatus stat = this->m_pktBuffer->deserialize(id);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+#if !FW_AMPCS_COMPATIBLE
+        stat = this->m_pktBuffer->deserialize(timeTag);
+        if (stat != FW_SERIALIZE_OK) {
+            return stat;
+        }
+#endif
+        if (bufferSize > buffer.getBuffCapacity()) {
+            return FW_DESERIALIZE_SIZE_MISMATCH;
+        }
+        stat = this->m_pktBuffer->deserialize(buffer.getBuffAddr(),bufferSize,true);
+        if (stat == FW_SERIALIZE_OK) {
+            // Shouldn't fail
+            stat = buffer.setBuffLen(bufferSize);
+            FW_ASSERT(stat == FW_SERIALIZE_OK,static_cast<NATIVE_INT_TYPE>(stat));
+        }
+        return stat;
+    }
+
 } /* namespace Fw */
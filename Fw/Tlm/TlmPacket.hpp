@@ -9,6 +9,7 @@
 #define TLMPACKET_HPP_
 
 #include <Fw/Com/ComPacket.hpp>
+#include <Fw/Com/ComBuffer.hpp>
 #include <Fw/Tlm/TlmBuffer.hpp>
 #include <Fw/Time/Time.hpp>
 
@@ -32,10 +33,39 @@ namespace Fw {
             Time& getTimeTag();
             TlmBuffer& getTlmBuffer();
 
+            // Multiple channel values can be packed into one packet. Each value
+            // is written as id, time tag and value, in the same layout as a
+            // single-value packet, so a packet with one value is identical to
+            // one from serialize(). Values carry no length, so a decoder must
+            // know the size of each channel's value to extract it.
+            // The packet is built in, or extracted from, a ComBuffer owned by
+            // the caller, so a TlmPacket used for single values carries no
+            // packet-sized storage of its own.
+
+            //! Set the buffer the packet of channel values is built in or
+            //! extracted from. It must outlive its use by this packet.
+            void setBuffer(ComBuffer& buffer);
+            //! Start a new packet of channel values. Call before adding values.
+            SerializeStatus resetPktSer();
+            //! Add a channel value to the packet. If the value does not fit,
+            //! FW_SERIALIZE_NO_ROOM_LEFT is returned and the packet is unchanged.
+            SerializeStatus addValue(FwChanIdType id, Time& timeTag, TlmBuffer& buffer);
+            //! Get the buffer holding the packet of channel values
+            ComBuffer& getBuffer();
+            //! Get the number of values added since resetPktSer()
+            NATIVE_UINT_TYPE getNumEntries() const;
+
+            //! Start extracting values from the packet. Call before extracting values.
+            SerializeStatus resetPktDeser();
+            //! Extract the next channel value from the packet
+            SerializeStatus extractValue(FwChanIdType &id, Time& timeTag, TlmBuffer& buffer, NATIVE_UINT_TYPE bufferSize);
+
         PROTECTED:
             FwChanIdType m_id; // !< Channel id
             Fw::Time m_timeTag; // !< time tag
             TlmBuffer m_tlmBuffer; // !< serialized data
+            ComBuffer* m_pktBuffer; // !< caller's buffer for a packet of multiple channel values
+            NATIVE_UINT_TYPE m_numEntries; // !< number of values in m_pktBuffer
     };
 
 } /* namespace Fw */
@@ -2,6 +2,8 @@
 #include <Fw/Tlm/TlmPacket.hpp>
 #include <Fw/Com/ComBuffer.hpp>
 
+#include <cstring>
+
 TEST(FwTlmTest,TlmPacketSerialize) {
 
     // Serialize data
@@ -34,6 +36,66 @@ TEST(FwTlmTest,TlmPacketSerialize) {
 
 }
 
+TEST(FwTlmTest,TlmPacketMultipleValues) {
+
+    Fw::TlmPacket pktIn;
+    Fw::ComBuffer pktBuff;
+    Fw::TlmBuffer buffIn;
+    Fw::Time timeIn(TB_WORKSTATION_TIME,10,11);
+
+    // add values until the packet is full
+    pktIn.setBuffer(pktBuff);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktIn.resetPktSer());
+    NATIVE_UINT_TYPE numValues = 0;
+    while (true) {
+        buffIn.resetSer();
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buffIn.serialize(static_cast<U32>(numValues*3)));
+        const NATIVE_UINT_TYPE before = pktIn.getBuffer().getBuffLength();
+        const Fw::SerializeStatus stat = pktIn.addValue(100 + numValues,timeIn,buffIn);
+        if (stat != Fw::FW_SERIALIZE_OK) {
+            // a value that doesn't fit leaves the packet unchanged
+            ASSERT_EQ(Fw::FW_SERIALIZE_NO_ROOM_LEFT,stat);
+            ASSERT_EQ(before,pktIn.getBuffer().getBuffLength());
+            break;
+        }
+        numValues++;
+    }
+    ASSERT_GT(numValues,1u);
+    ASSERT_EQ(numValues,pktIn.getNumEntries());
+
+    // extract the values
+    Fw::TlmPacket pktOut;
+    pktOut.setBuffer(pktBuff);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktOut.resetPktDeser());
+    for (NATIVE_UINT_TYPE value = 0; value < numValues; value++) {
+        FwChanIdType id;
+        Fw::Time timeOut;
+        Fw::TlmBuffer buffOut;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktOut.extractValue(id,timeOut,buffOut,sizeof(U32)));
+        ASSERT_EQ(100 + value,id);
+        ASSERT_EQ(timeIn,timeOut);
+        U32 valOut = 0;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buffOut.deserialize(valOut));
+        ASSERT_EQ(value*3,valOut);
+    }
+    ASSERT_EQ(0u,pktOut.getBuffer().getBuffLeft());
+
+    // a packet with one value matches the single value format
+    Fw::TlmPacket pktSingle;
+    buffIn.resetSer();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,buffIn.serialize(static_cast<U32>(12)));
+    pktSingle.setId(10);
+    pktSingle.setTimeTag(timeIn);
+    pktSingle.setTlmBuffer(buffIn);
+    Fw::ComBuffer comBuff;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,comBuff.serialize(pktSingle));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktIn.resetPktSer());
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,pktIn.addValue(10,timeIn,buffIn));
+    ASSERT_EQ(comBuff.getBuffLength(),pktIn.getBuffer().getBuffLength());
+    ASSERT_EQ(0,memcmp(comBuff.getBuffAddr(),pktIn.getBuffer().getBuffAddr(),comBuff.getBuffLength()));
+
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
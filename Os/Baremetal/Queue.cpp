@@ -36,10 +36,13 @@ class BareQueueHandle {
 };
 
 Queue::Queue() :
-    m_handle(reinterpret_cast<POINTER_CAST>(nullptr))
+    m_handle(reinterpret_cast<POINTER_CAST>(nullptr)),
+    m_sendNotifier(nullptr),
+    m_sendNotifierArg(nullptr)
 { }
 
-Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize, QueueConcurrency concurrency) {
+    (void) concurrency; // Single threaded: every queue is already lock free
     BareQueueHandle* handle = reinterpret_cast<BareQueueHandle*>(this->m_handle);
     // Queue has already been created... remove it and try again:
     if (nullptr != handle) {
@@ -118,11 +121,17 @@ Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_IN
         return QUEUE_SIZE_MISMATCH;
     }
     //Send to the queue
+    QueueStatus status = QUEUE_OK;
     if( QUEUE_NONBLOCKING == block ) {
-        return bareSendNonBlock(handle, buffer, size, priority);
+        status = bareSendNonBlock(handle, buffer, size, priority);
+    } else {
+        status = bareSendBlock(handle, buffer, size, priority);
     }
-
-    return bareSendBlock(handle, buffer, size, priority);
+    //Notify after a successful send
+    if (QUEUE_OK == status) {
+        this->notifySent();
+    }
+    return status;
 }
 
 Queue::QueueStatus bareReceiveNonBlock(BareQueueHandle& handle, U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority) {
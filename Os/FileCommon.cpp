@@ -3,22 +3,14 @@
 #include <Os/File.hpp>
 #include <Fw/Types/Assert.hpp>
 
-#ifdef __cplusplus
-extern "C" {
-#endif // __cplusplus
-
-#include <Utils/Hash/libcrc/lib_crc.h> // borrow CRC
-
-#ifdef __cplusplus
-}
-#endif // __cplusplus
+#include <Utils/Hash/slicecrc/SliceCrc32.hpp>
 
 namespace Os {
     File::Status File::niceCRC32(U32 &crc, const char* fileName)
     {
         //Constants used in this function
         const U32 CHUNK_SIZE = 4096;
-        const U32 INITIAL_SEED = 0xFFFFFFFF;
+        const U32 INITIAL_SEED = Utils::SliceCrc32::INITIAL;
         const U32 MAX_IT = 0xFFFFFFFF; //Max int for U32
         //Loop variables for calculating CRC
         NATIVE_INT_TYPE offset = 0;
@@ -48,9 +40,7 @@ namespace Os {
             //Close file, then update CRC. This reduces time file is required open
             file.close();
             if (chunk != 0 && status == OP_OK) {
-                for (U32 ci = 0; static_cast<NATIVE_INT_TYPE>(ci) < chunk; ci++) {
-                    seed = update_crc_32(seed, file_buffer[ci]);
-                }
+                seed = Utils::SliceCrc32::update(seed, file_buffer, static_cast<NATIVE_UINT_TYPE>(chunk));
             } else if (chunk == 0 && status == OP_OK) {
                 eof = true;
                 break;
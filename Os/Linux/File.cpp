@@ -3,15 +3,7 @@
 #include <Os/File.hpp>
 #include <Fw/Types/Assert.hpp>
 
-#ifdef __cplusplus
-extern "C" {
-#endif // __cplusplus
-
-#include <Utils/Hash/libcrc/lib_crc.h> // borrow CRC
-
-#ifdef __cplusplus
-}
-#endif // __cplusplus
+#include <Utils/Hash/slicecrc/SliceCrc32.hpp>
 
 #include <cerrno>
 #include <sys/types.h>
@@ -427,8 +419,7 @@ namespace Os {
             return NOT_OPENED;
         }
 
-        const U32 maxChunkSize = 32;
-        const U32 initialSeed = 0xFFFFFFFF;
+        const NATIVE_INT_TYPE maxChunkSize = FW_FILE_CRC_CHUNK_SIZE;
 
         // Seek to beginning of file
         Status status = seek(0, true);
@@ -437,18 +428,24 @@ namespace Os {
             return status;
         }
 
+#if defined(POSIX_FADV_SEQUENTIAL)
+        // Hint that the whole file will be read once, front to back, so the
+        // kernel reads ahead aggressively. Failure only costs performance.
+        (void) posix_fadvise(this->m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
         U8 file_buffer[maxChunkSize];
 
         bool endOfFile = false;
 
-        U32 seed = initialSeed;
+        U32 seed = Utils::SliceCrc32::INITIAL;
         const U32 maxIters = std::numeric_limits<U32>::max(); // loop limit
         U32 numIters = 0;
 
         while (!endOfFile && numIters < maxIters) {
 
             ++numIters;
-            int chunkSize = maxChunkSize;
+            NATIVE_INT_TYPE chunkSize = maxChunkSize;
 
             status = read(file_buffer, chunkSize, false);
             if (status == OP_OK) {
@@ -459,12 +456,7 @@ namespace Os {
                     continue;
                 }
 
-                int chunkIdx = 0;
-
-                while (chunkIdx < chunkSize) {
-                  seed = update_crc_32(seed, file_buffer[chunkIdx]);
-                  chunkIdx++;
-                }
+                seed = Utils::SliceCrc32::update(seed, file_buffer, static_cast<NATIVE_UINT_TYPE>(chunkSize));
 
             } else {
                 crc = 0;
@@ -49,10 +49,13 @@ namespace Os {
     };
 
     Queue::Queue() :
-        m_handle(-1) {
+        m_handle(-1),
+        m_sendNotifier(nullptr),
+        m_sendNotifierArg(nullptr) {
     }
 
-    Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+    Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize, QueueConcurrency concurrency) {
+        (void) concurrency; // Message queues are kernel objects; all access patterns share one implementation
 
         this->m_name = "/QP_";
         this->m_name += name;
@@ -164,6 +167,7 @@ namespace Os {
             }
         }
 
+        this->notifySent();
         return QUEUE_OK;
     }
 
@@ -1,10 +1,10 @@
 // ======================================================================
 // \title  PriorityBufferQueue.hpp
 // \author dinkel
-// \brief  An implementation of BufferQueue which uses a stable max heap
-//         data structure for the queue. Items of highest priority will
-//         be popped off of the queue first. Items of equal priority will
-//         be popped off the queue in FIFO order.
+// \brief  An implementation of BufferQueue which keeps one FIFO list
+//         per priority level. Items of highest priority will be popped
+//         off of the queue first. Items of equal priority will be
+//         popped off the queue in FIFO order.
 //
 // \copyright
 // Copyright 2009-2015, by the California Institute of Technology.
@@ -14,52 +14,125 @@
 // ======================================================================
 
 #include "Os/Pthreads/BufferQueue.hpp"
-#include "Os/Pthreads/MaxHeap/MaxHeap.hpp"
 #include <Fw/Types/Assert.hpp>
 #include <cstring>
 #include <cstdio>
 #include <new>
 
-// This is a priority queue implementation implemented using a stable max heap.
-// Elements pushed onto the queue will be popped off in priority order.
-// Elements of the same priority will be popped off in FIFO order.
+// This is a priority queue implementation using bucketed priority levels.
+// Every distinct priority seen on the queue gets a level holding a FIFO list
+// of message slots, and the levels are kept sorted by priority. A bitmap of
+// the non-empty levels lets a pop find the highest priority message without
+// searching, so pushing and popping a message is constant time once its
+// priority has a level. Components use only a handful of distinct priorities,
+// so levels are created rarely; empty levels are kept for reuse and only
+// reclaimed when the level table runs out of room.
 namespace Os {
 
   /////////////////////////////////////////////////////
   // Queue handler:
   /////////////////////////////////////////////////////
 
+  // Marks the end of a slot list:
+  static const NATIVE_UINT_TYPE NO_SLOT = ~static_cast<NATIVE_UINT_TYPE>(0);
+  // Bits per word of the non-empty level bitmap:
+  static const NATIVE_UINT_TYPE BITS_PER_WORD = 32;
+
+  struct PriorityLevel {
+    NATIVE_INT_TYPE priority; // priority of every message in this level
+    NATIVE_UINT_TYPE head; // oldest slot in the level, NO_SLOT when empty
+    NATIVE_UINT_TYPE tail; // newest slot in the level
+  };
+
   struct PriorityQueue {
-    MaxHeap* heap;
     U8* data;
-    NATIVE_UINT_TYPE* indexes;
-    NATIVE_UINT_TYPE startIndex;
-    NATIVE_UINT_TYPE stopIndex;
+    NATIVE_UINT_TYPE* next; // per slot: next slot in its level, or in the free list
+    NATIVE_UINT_TYPE freeHead; // first free slot
+    PriorityLevel* levels; // levels sorted by ascending priority
+    NATIVE_UINT_TYPE numLevels; // levels in use, empty or not
+    U32* nonEmpty; // bit n set when levels[n] holds a message
+    NATIVE_UINT_TYPE numWords; // words in the nonEmpty bitmap
   };
 
   /////////////////////////////////////////////////////
   // Helper functions:
   /////////////////////////////////////////////////////
 
-  NATIVE_UINT_TYPE checkoutIndex(PriorityQueue* pQueue, NATIVE_UINT_TYPE depth) {
-    NATIVE_UINT_TYPE* indexes = pQueue->indexes;
+  static NATIVE_UINT_TYPE highestBit(U32 word) {
+    NATIVE_UINT_TYPE bit = 0;
+    if (word & 0xFFFF0000U) { word >>= 16; bit += 16; }
+    if (word & 0xFF00U) { word >>= 8; bit += 8; }
+    if (word & 0xF0U) { word >>= 4; bit += 4; }
+    if (word & 0xCU) { word >>= 2; bit += 2; }
+    if (word & 0x2U) { bit += 1; }
+    return bit;
+  }
+
+  static void setNonEmpty(PriorityQueue* pQueue, NATIVE_UINT_TYPE level) {
+    pQueue->nonEmpty[level / BITS_PER_WORD] |= (1U << (level % BITS_PER_WORD));
+  }
+
+  static void clearNonEmpty(PriorityQueue* pQueue, NATIVE_UINT_TYPE level) {
+    pQueue->nonEmpty[level / BITS_PER_WORD] &= ~(1U << (level % BITS_PER_WORD));
+  }
 
-    // Get an available index from the index pool:
-    NATIVE_UINT_TYPE index = indexes[pQueue->startIndex % depth];
-    ++pQueue->startIndex;
-    NATIVE_UINT_TYPE diff = pQueue->stopIndex - pQueue->startIndex;
-    FW_ASSERT(diff <= depth, diff, depth, pQueue->stopIndex, pQueue->startIndex);
-    return index;
+  static void rebuildNonEmpty(PriorityQueue* pQueue) {
+    memset(pQueue->nonEmpty, 0, pQueue->numWords * sizeof(U32));
+    for (NATIVE_UINT_TYPE ii = 0; ii < pQueue->numLevels; ++ii) {
+      if (NO_SLOT != pQueue->levels[ii].head) {
+        setNonEmpty(pQueue, ii);
+      }
+    }
   }
 
-  void returnIndex(PriorityQueue* pQueue, NATIVE_UINT_TYPE depth, NATIVE_UINT_TYPE index) {
-    NATIVE_UINT_TYPE* indexes = pQueue->indexes;
+  // Position of the first level with priority >= the given priority:
+  static NATIVE_UINT_TYPE lowerBound(PriorityQueue* pQueue, NATIVE_INT_TYPE priority) {
+    NATIVE_UINT_TYPE low = 0;
+    NATIVE_UINT_TYPE high = pQueue->numLevels;
+    while (low < high) {
+      const NATIVE_UINT_TYPE mid = low + (high - low) / 2;
+      if (pQueue->levels[mid].priority < priority) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  }
 
-    // Return the index back to the index pool:
-    indexes[pQueue->stopIndex % depth] = index;
-    ++pQueue->stopIndex;
-    NATIVE_UINT_TYPE diff = pQueue->stopIndex - pQueue->startIndex;
-    FW_ASSERT(diff <= depth, diff, depth, pQueue->stopIndex, pQueue->startIndex);
+  // Drop every empty level, keeping the rest in order:
+  static void compactLevels(PriorityQueue* pQueue) {
+    NATIVE_UINT_TYPE kept = 0;
+    for (NATIVE_UINT_TYPE ii = 0; ii < pQueue->numLevels; ++ii) {
+      if (NO_SLOT != pQueue->levels[ii].head) {
+        pQueue->levels[kept++] = pQueue->levels[ii];
+      }
+    }
+    pQueue->numLevels = kept;
+  }
+
+  static NATIVE_UINT_TYPE getLevel(PriorityQueue* pQueue, NATIVE_UINT_TYPE depth, NATIVE_INT_TYPE priority) {
+    NATIVE_UINT_TYPE level = lowerBound(pQueue, priority);
+    if (level < pQueue->numLevels && pQueue->levels[level].priority == priority) {
+      return level;
+    }
+
+    // New priority. The queue is not full, so there are fewer non-empty
+    // levels than slots and compacting always frees an entry:
+    if (pQueue->numLevels == depth) {
+      compactLevels(pQueue);
+      FW_ASSERT(pQueue->numLevels < depth, pQueue->numLevels, depth);
+      level = lowerBound(pQueue, priority);
+    }
+    for (NATIVE_UINT_TYPE ii = pQueue->numLevels; ii > level; --ii) {
+      pQueue->levels[ii] = pQueue->levels[ii - 1];
+    }
+    pQueue->levels[level].priority = priority;
+    pQueue->levels[level].head = NO_SLOT;
+    pQueue->levels[level].tail = NO_SLOT;
+    ++pQueue->numLevels;
+    rebuildNonEmpty(pQueue);
+    return level;
   }
 
   /////////////////////////////////////////////////////
@@ -68,40 +141,33 @@ namespace Os {
 
   bool BufferQueue::initialize(NATIVE_UINT_TYPE depth, NATIVE_UINT_TYPE msgSize) {
     // Create the priority queue data structure on the heap:
-    MaxHeap* heap = new(std::nothrow) MaxHeap;
-    if (nullptr == heap) {
-      return false;
-    }
-    if( !heap->create(depth) ) {
-      delete heap;
-      return false;
-    }
+    const NATIVE_UINT_TYPE numWords = (depth + BITS_PER_WORD - 1) / BITS_PER_WORD;
     U8* data = new(std::nothrow) U8[depth*(sizeof(msgSize) + msgSize)];
-    if (nullptr == data) {
-      delete heap;
-      return false;
-    }
-    NATIVE_UINT_TYPE* indexes = new(std::nothrow) NATIVE_UINT_TYPE[depth];
-    if (nullptr == indexes) {
-      delete heap;
+    NATIVE_UINT_TYPE* next = new(std::nothrow) NATIVE_UINT_TYPE[depth];
+    PriorityLevel* levels = new(std::nothrow) PriorityLevel[depth];
+    U32* nonEmpty = new(std::nothrow) U32[numWords];
+    PriorityQueue* priorityQueue = new(std::nothrow) PriorityQueue;
+    if (nullptr == data || nullptr == next || nullptr == levels || nullptr == nonEmpty || nullptr == priorityQueue) {
       delete[] data;
+      delete[] next;
+      delete[] levels;
+      delete[] nonEmpty;
+      delete priorityQueue;
       return false;
     }
+    // Chain every slot into the free list:
     for(NATIVE_UINT_TYPE ii = 0; ii < depth; ++ii) {
-        indexes[ii] = getBufferIndex(ii);
+        next[ii] = (ii + 1 < depth) ? ii + 1 : NO_SLOT;
     }
-    PriorityQueue* priorityQueue = new(std::nothrow) PriorityQueue;
-    if (nullptr == priorityQueue) {
-      delete heap;
-      delete[] data;
-      delete[] indexes;
-      return false;
-    }
-    priorityQueue->heap = heap;
+    memset(nonEmpty, 0, numWords * sizeof(U32));
+
     priorityQueue->data = data;
-    priorityQueue->indexes = indexes;
-    priorityQueue->startIndex = 0;
-    priorityQueue->stopIndex = depth;
+    priorityQueue->next = next;
+    priorityQueue->freeHead = 0;
+    priorityQueue->levels = levels;
+    priorityQueue->numLevels = 0;
+    priorityQueue->nonEmpty = nonEmpty;
+    priorityQueue->numWords = numWords;
     this->queue = priorityQueue;
     return true;
   }
@@ -110,19 +176,10 @@ namespace Os {
     PriorityQueue* pQueue = static_cast<PriorityQueue*>(this->queue);
     if (nullptr != pQueue)
     {
-      MaxHeap* heap = pQueue->heap;
-      if (nullptr != heap) {
-        delete heap;
-      }
-      U8* data = pQueue->data;
-      if (nullptr != data) {
-        delete [] data;
-      }
-      NATIVE_UINT_TYPE* indexes = pQueue->indexes;
-      if (nullptr != indexes)
-      {
-        delete [] indexes;
-      }
+      delete [] pQueue->data;
+      delete [] pQueue->next;
+      delete [] pQueue->levels;
+      delete [] pQueue->nonEmpty;
       delete pQueue;
     }
     this->queue = nullptr;
@@ -132,18 +189,27 @@ namespace Os {
 
     // Extract queue handle variables:
     PriorityQueue* pQueue = static_cast<PriorityQueue*>(this->queue);
-    MaxHeap* heap = pQueue->heap;
-    U8* data = pQueue->data;
-
-    // Get an available data index:
-    NATIVE_UINT_TYPE index = checkoutIndex(pQueue, this->depth);
+    NATIVE_UINT_TYPE* next = pQueue->next;
 
-    // Insert the data into the heap:
-    bool ret = heap->push(priority, index);
-    FW_ASSERT(ret, ret);
+    // Get an available slot:
+    const NATIVE_UINT_TYPE slot = pQueue->freeHead;
+    FW_ASSERT(slot < this->depth, slot, this->depth);
+    pQueue->freeHead = next[slot];
 
     // Store the buffer to the queue:
-    this->enqueueBuffer(buffer, size, data, index);
+    this->enqueueBuffer(buffer, size, pQueue->data, this->getBufferIndex(static_cast<NATIVE_INT_TYPE>(slot)));
+
+    // Append the slot to its priority level:
+    const NATIVE_UINT_TYPE level = getLevel(pQueue, this->depth, priority);
+    PriorityLevel& entry = pQueue->levels[level];
+    next[slot] = NO_SLOT;
+    if (NO_SLOT == entry.head) {
+      entry.head = slot;
+      setNonEmpty(pQueue, level);
+    } else {
+      next[entry.tail] = slot;
+    }
+    entry.tail = slot;
 
     return true;
   }
@@ -152,25 +218,34 @@ namespace Os {
 
     // Extract queue handle variables:
     PriorityQueue* pQueue = static_cast<PriorityQueue*>(this->queue);
-    MaxHeap* heap = pQueue->heap;
-    U8* data = pQueue->data;
-
-    // Get the highest priority data from the heap:
-    NATIVE_UINT_TYPE index = 0;
-    bool ret = heap->pop(priority, index);
-    FW_ASSERT(ret, ret);
-
-    ret = this->dequeueBuffer(buffer, size, data, index);
-    if(!ret) {
-      // The dequeue failed, so push the popped
-      // value back on the heap.
-      ret = heap->push(priority, index);
-      FW_ASSERT(ret, ret);
+    NATIVE_UINT_TYPE* next = pQueue->next;
+
+    // Find the highest non-empty priority level, searching only the words
+    // that cover levels in use:
+    NATIVE_UINT_TYPE word = (pQueue->numLevels + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    do {
+      FW_ASSERT(word > 0); // pop() has already checked the queue is not empty
+      --word;
+    } while (0 == pQueue->nonEmpty[word]);
+    const NATIVE_UINT_TYPE level = word * BITS_PER_WORD + highestBit(pQueue->nonEmpty[word]);
+    PriorityLevel& entry = pQueue->levels[level];
+    const NATIVE_UINT_TYPE slot = entry.head;
+    FW_ASSERT(slot < this->depth, slot, this->depth);
+
+    // If the buffer is too small the message stays at the front of its level:
+    if (!this->dequeueBuffer(buffer, size, pQueue->data, this->getBufferIndex(static_cast<NATIVE_INT_TYPE>(slot)))) {
       return false;
     }
+    priority = entry.priority;
 
-    // Return the index to the available indexes:
-    returnIndex(pQueue, this->depth, index);
+    // Unlink the slot and return it to the free list:
+    entry.head = next[slot];
+    if (NO_SLOT == entry.head) {
+      entry.tail = NO_SLOT;
+      clearNonEmpty(pQueue, level);
+    }
+    next[slot] = pQueue->freeHead;
+    pQueue->freeHead = slot;
 
     return true;
   }
@@ -13,6 +13,7 @@
 // ======================================================================
 
 #include <Os/Pthreads/BufferQueue.hpp>
+#include <Os/Pthreads/SpscQueue.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Os/Queue.hpp>
 
@@ -25,10 +26,12 @@ namespace Os {
 
   // A helper class which stores variables for the queue handle.
   // The queue itself, a pthread condition variable, and pthread
-  // mutex are contained within this container class.
+  // mutex are contained within this container class. Queues created
+  // as QUEUE_SPSC use the lock-free ring instead and never touch
+  // the shared queue or its lock.
   class QueueHandle {
     public:
-    QueueHandle() {
+    QueueHandle() : concurrency(Queue::QUEUE_SHARED) {
       int ret;
       ret = pthread_cond_init(&this->queueNotEmpty, nullptr);
       FW_ASSERT(ret == 0, ret); // If this fails, something horrible happened.
@@ -42,9 +45,18 @@ namespace Os {
       (void) pthread_cond_destroy(&this->queueNotFull);
       (void) pthread_mutex_destroy(&this->queueLock);
     }
-    bool create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+    bool create(NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize, Queue::QueueConcurrency concurrency) {
+      this->concurrency = concurrency;
+      if (Queue::QUEUE_SPSC == concurrency) {
+        return spscQueue.create(depth, msgSize);
+      }
       return queue.create(depth, msgSize);
     }
+    bool isSpsc() const {
+      return Queue::QUEUE_SPSC == this->concurrency;
+    }
+    Queue::QueueConcurrency concurrency;
+    SpscQueue spscQueue;
     BufferQueue queue;
     pthread_cond_t queueNotEmpty;
     pthread_cond_t queueNotFull;
@@ -52,10 +64,12 @@ namespace Os {
   };
 
   Queue::Queue() :
-    m_handle(reinterpret_cast<POINTER_CAST>(nullptr)) {
+    m_handle(reinterpret_cast<POINTER_CAST>(nullptr)),
+    m_sendNotifier(nullptr),
+    m_sendNotifierArg(nullptr) {
   }
 
-  Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+  Queue::QueueStatus Queue::createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize, QueueConcurrency concurrency) {
     QueueHandle* queueHandle = reinterpret_cast<QueueHandle*>(this->m_handle);
 
     // Queue has already been created... remove it and try again:
@@ -69,7 +83,7 @@ namespace Os {
     if (nullptr == queueHandle) {
       return QUEUE_UNINITIALIZED;
     }
-    if( !queueHandle->create(depth, msgSize) ) {
+    if( !queueHandle->create(depth, msgSize, concurrency) ) {
       return QUEUE_UNINITIALIZED;
     }
     this->m_handle = reinterpret_cast<POINTER_CAST>(queueHandle);
@@ -175,10 +189,18 @@ namespace Os {
   }
 
 
+  Queue::QueueStatus sendSpsc(QueueHandle* queueHandle, const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority, bool block) {
+
+    // No lock: the ring only blocks when it is full and "block" is set.
+    if( !queueHandle->spscQueue.push(buffer, static_cast<NATIVE_UINT_TYPE>(size), priority, block) ) {
+      return Queue::QUEUE_FULL;
+    }
+    return Queue::QUEUE_OK;
+  }
+
   Queue::QueueStatus Queue::send(const U8* buffer, NATIVE_INT_TYPE size, NATIVE_INT_TYPE priority, QueueBlocking block) {
     (void) block; // Always non-blocking for now
     QueueHandle* queueHandle = reinterpret_cast<QueueHandle*>(this->m_handle);
-    BufferQueue* queue = &queueHandle->queue;
 
     if (nullptr == queueHandle) {
         return QUEUE_UNINITIALIZED;
@@ -188,15 +210,25 @@ namespace Os {
         return QUEUE_EMPTY_BUFFER;
     }
 
-    if (size < 0 || static_cast<NATIVE_UINT_TYPE>(size) > queue->getMsgSize()) {
+    if (size < 0 || static_cast<NATIVE_UINT_TYPE>(size) > static_cast<NATIVE_UINT_TYPE>(this->getMsgSize())) {
         return QUEUE_SIZE_MISMATCH;
     }
 
-    if( QUEUE_NONBLOCKING == block ) {
-      return sendNonBlock(queueHandle, buffer, size, priority);
+    QueueStatus status = QUEUE_OK;
+    if( queueHandle->isSpsc() ) {
+      status = sendSpsc(queueHandle, buffer, size, priority, QUEUE_BLOCKING == block);
+    }
+    else if( QUEUE_NONBLOCKING == block ) {
+      status = sendNonBlock(queueHandle, buffer, size, priority);
+    }
+    else {
+      status = sendBlock(queueHandle, buffer, size, priority);
     }
 
-    return sendBlock(queueHandle, buffer, size, priority);
+    if( QUEUE_OK == status ) {
+      this->notifySent();
+    }
+    return status;
   }
 
   Queue::QueueStatus receiveNonBlock(QueueHandle* queueHandle, U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority) {
@@ -316,6 +348,27 @@ namespace Os {
       return status;
   }
 
+  Queue::QueueStatus receiveSpsc(QueueHandle* queueHandle, U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, bool block) {
+
+      NATIVE_UINT_TYPE size = static_cast<NATIVE_UINT_TYPE>(capacity);
+      NATIVE_INT_TYPE pri = 0;
+
+      if( queueHandle->spscQueue.pop(buffer, size, pri, block) ) {
+        actualSize = static_cast<NATIVE_INT_TYPE>(size);
+        priority = pri;
+        return Queue::QUEUE_OK;
+      }
+
+      actualSize = 0;
+      if( size > static_cast<NATIVE_UINT_TYPE>(capacity) ) {
+        // The buffer capacity was too small!
+        return Queue::QUEUE_SIZE_MISMATCH;
+      }
+      // A blocking pop only fails if the user's buffer was too small:
+      FW_ASSERT(!block && 0 == size, block, size);
+      return Queue::QUEUE_NO_MORE_MSGS;
+  }
+
   Queue::QueueStatus Queue::receive(U8* buffer, NATIVE_INT_TYPE capacity, NATIVE_INT_TYPE &actualSize, NATIVE_INT_TYPE &priority, QueueBlocking block) {
 
       if( reinterpret_cast<POINTER_CAST>(nullptr) == this->m_handle ) {
@@ -334,6 +387,10 @@ namespace Os {
           return QUEUE_SIZE_MISMATCH;
       }
 
+      if( queueHandle->isSpsc() ) {
+        return receiveSpsc(queueHandle, buffer, capacity, actualSize, priority, QUEUE_BLOCKING == block);
+      }
+
       if( QUEUE_NONBLOCKING == block ) {
         return receiveNonBlock(queueHandle, buffer, capacity, actualSize, priority);
       }
@@ -346,8 +403,16 @@ namespace Os {
       if (nullptr == queueHandle) {
           return 0;
       }
+      if (queueHandle->isSpsc()) {
+          return queueHandle->spscQueue.getCount();
+      }
       BufferQueue* queue = &queueHandle->queue;
-      return queue->getCount();
+      // Read under the lock so a sender's message is seen by a thread that only polls the count
+      pthread_mutex_t* queueLock = &queueHandle->queueLock;
+      (void)pthread_mutex_lock(queueLock);
+      NATIVE_INT_TYPE count = queue->getCount();
+      (void)pthread_mutex_unlock(queueLock);
+      return count;
   }
 
   NATIVE_INT_TYPE Queue::getMaxMsgs() const {
@@ -355,6 +420,9 @@ namespace Os {
       if (nullptr == queueHandle) {
           return 0;
       }
+      if (queueHandle->isSpsc()) {
+          return queueHandle->spscQueue.getMaxCount();
+      }
       BufferQueue* queue = &queueHandle->queue;
       return queue->getMaxCount();
   }
@@ -364,6 +432,9 @@ namespace Os {
       if (nullptr == queueHandle) {
           return 0;
       }
+      if (queueHandle->isSpsc()) {
+          return queueHandle->spscQueue.getDepth();
+      }
       BufferQueue* queue = &queueHandle->queue;
       return queue->getDepth();
   }
@@ -373,6 +444,9 @@ namespace Os {
       if (nullptr == queueHandle) {
           return 0;
       }
+      if (queueHandle->isSpsc()) {
+          return queueHandle->spscQueue.getMsgSize();
+      }
       BufferQueue* queue = &queueHandle->queue;
       return queue->getMsgSize();
   }
@@ -0,0 +1,216 @@
+// ======================================================================
+// \title  SpscQueue.cpp
+// \brief  Implementation of the lock-free single-producer,
+//         single-consumer buffer ring declared in SpscQueue.hpp.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Os/Pthreads/SpscQueue.hpp"
+#include <Fw/Types/Assert.hpp>
+
+#include <cstring>
+#include <new>
+
+// The head and tail are free-running counters and the number of messages on
+// the ring is their difference. The ring has a power-of-two number of slots,
+// at least the depth, so a position maps to the same slot on either side of
+// the 2^32 wrap of the counters. Each side publishes its index with a
+// sequentially consistent store and then checks the other side's waiting
+// flag; a side about to sleep sets its flag and then re-checks the index.
+// Under the single total order of these operations at least one of the two
+// sees the other, so a wake-up is never lost while the fast path stays free
+// of any lock.
+
+namespace Os {
+
+  SpscQueue::SpscQueue() :
+    m_tail(0),
+    m_head(0),
+    m_consumerWaiting(false),
+    m_producerWaiting(false),
+    m_maxCount(0),
+    m_data(nullptr),
+    m_msgSize(0),
+    m_depth(0),
+    m_slotMask(0),
+    m_slotSize(0)
+  {
+    int ret;
+    ret = pthread_mutex_init(&this->m_waitLock, nullptr);
+    FW_ASSERT(ret == 0, ret); // If this fails, something horrible happened.
+    ret = pthread_cond_init(&this->m_notEmpty, nullptr);
+    FW_ASSERT(ret == 0, ret); // If this fails, something horrible happened.
+    ret = pthread_cond_init(&this->m_notFull, nullptr);
+    FW_ASSERT(ret == 0, ret); // If this fails, something horrible happened.
+  }
+
+  SpscQueue::~SpscQueue() {
+    this->finalize();
+    (void) pthread_cond_destroy(&this->m_notEmpty);
+    (void) pthread_cond_destroy(&this->m_notFull);
+    (void) pthread_mutex_destroy(&this->m_waitLock);
+  }
+
+  bool SpscQueue::create(NATIVE_UINT_TYPE depth, NATIVE_UINT_TYPE msgSize) {
+    // Queue is already set up. destroy it and try again:
+    this->finalize();
+    // Positions are compared modulo 2^32, so the depth must fit in half of that:
+    FW_ASSERT(depth > 0 && depth <= 0x80000000U, depth);
+
+    NATIVE_UINT_TYPE slots = 1;
+    while (slots < depth) {
+      slots <<= 1;
+    }
+
+    const NATIVE_UINT_TYPE header = sizeof(NATIVE_UINT_TYPE) + sizeof(NATIVE_INT_TYPE);
+    this->m_slotSize = header + msgSize;
+    U8* data = new(std::nothrow) U8[slots * this->m_slotSize];
+    if (nullptr == data) {
+      return false;
+    }
+    this->m_data = data;
+    this->m_msgSize = msgSize;
+    this->m_depth = depth;
+    this->m_slotMask = slots - 1;
+    this->m_head.store(0, std::memory_order_relaxed);
+    this->m_tail.store(0, std::memory_order_relaxed);
+    this->m_maxCount.store(0, std::memory_order_relaxed);
+    return true;
+  }
+
+  void SpscQueue::finalize() {
+    if (nullptr != this->m_data) {
+      delete[] this->m_data;
+      this->m_data = nullptr;
+    }
+    this->m_depth = 0;
+    this->m_slotMask = 0;
+  }
+
+  U8* SpscQueue::getSlot(U32 position) const {
+    return &this->m_data[(position & this->m_slotMask) * this->m_slotSize];
+  }
+
+  bool SpscQueue::push(const U8* buffer, NATIVE_UINT_TYPE size, NATIVE_INT_TYPE priority, bool block) {
+    FW_ASSERT(size <= this->m_msgSize, size, this->m_msgSize);
+
+    const U32 tail = this->m_tail.load(std::memory_order_relaxed);
+    U32 head = this->m_head.load(std::memory_order_acquire);
+
+    if (tail - head == this->m_depth) {
+      if (!block) {
+        return false;
+      }
+      NATIVE_INT_TYPE ret = pthread_mutex_lock(&this->m_waitLock);
+      FW_ASSERT(ret == 0, ret);
+      this->m_producerWaiting.store(true, std::memory_order_seq_cst);
+      while (tail - (head = this->m_head.load(std::memory_order_seq_cst)) == this->m_depth) {
+        ret = pthread_cond_wait(&this->m_notFull, &this->m_waitLock);
+        FW_ASSERT(ret == 0, ret);
+      }
+      this->m_producerWaiting.store(false, std::memory_order_relaxed);
+      ret = pthread_mutex_unlock(&this->m_waitLock);
+      FW_ASSERT(ret == 0, ret);
+    }
+
+    // Fill the slot, then publish it:
+    U8* slot = this->getSlot(tail);
+    (void) memcpy(slot, &size, sizeof(size));
+    slot += sizeof(size);
+    (void) memcpy(slot, &priority, sizeof(priority));
+    slot += sizeof(priority);
+    (void) memcpy(slot, buffer, size);
+    this->m_tail.store(tail + 1, std::memory_order_seq_cst);
+
+    // High water mark as seen by the producer:
+    const NATIVE_UINT_TYPE count = tail + 1 - head;
+    if (count > this->m_maxCount.load(std::memory_order_relaxed)) {
+      this->m_maxCount.store(count, std::memory_order_relaxed);
+    }
+
+    if (this->m_consumerWaiting.load(std::memory_order_seq_cst)) {
+      NATIVE_INT_TYPE ret = pthread_mutex_lock(&this->m_waitLock);
+      FW_ASSERT(ret == 0, ret);
+      ret = pthread_cond_signal(&this->m_notEmpty);
+      FW_ASSERT(ret == 0, ret);
+      ret = pthread_mutex_unlock(&this->m_waitLock);
+      FW_ASSERT(ret == 0, ret);
+    }
+    return true;
+  }
+
+  bool SpscQueue::pop(U8* buffer, NATIVE_UINT_TYPE& size, NATIVE_INT_TYPE &priority, bool block) {
+    const U32 head = this->m_head.load(std::memory_order_relaxed);
+
+    if (this->m_tail.load(std::memory_order_acquire) == head) {
+      if (!block) {
+        size = 0;
+        return false;
+      }
+      NATIVE_INT_TYPE ret = pthread_mutex_lock(&this->m_waitLock);
+      FW_ASSERT(ret == 0, ret);
+      this->m_consumerWaiting.store(true, std::memory_order_seq_cst);
+      while (this->m_tail.load(std::memory_order_seq_cst) == head) {
+        ret = pthread_cond_wait(&this->m_notEmpty, &this->m_waitLock);
+        FW_ASSERT(ret == 0, ret);
+      }
+      this->m_consumerWaiting.store(false, std::memory_order_relaxed);
+      ret = pthread_mutex_unlock(&this->m_waitLock);
+      FW_ASSERT(ret == 0, ret);
+    }
+
+    const U8* slot = this->getSlot(head);
+    NATIVE_UINT_TYPE storedSize;
+    (void) memcpy(&storedSize, slot, sizeof(storedSize));
+    // If the buffer passed in is not big enough, leave the message on the
+    // queue and pass out its size:
+    if (storedSize > size) {
+      size = storedSize;
+      return false;
+    }
+    slot += sizeof(storedSize);
+    (void) memcpy(&priority, slot, sizeof(priority));
+    slot += sizeof(priority);
+    (void) memcpy(buffer, slot, storedSize);
+    size = storedSize;
+
+    // Release the slot back to the producer:
+    this->m_head.store(head + 1, std::memory_order_seq_cst);
+
+    if (this->m_producerWaiting.load(std::memory_order_seq_cst)) {
+      NATIVE_INT_TYPE ret = pthread_mutex_lock(&this->m_waitLock);
+      FW_ASSERT(ret == 0, ret);
+      ret = pthread_cond_signal(&this->m_notFull);
+      FW_ASSERT(ret == 0, ret);
+      ret = pthread_mutex_unlock(&this->m_waitLock);
+      FW_ASSERT(ret == 0, ret);
+    }
+    return true;
+  }
+
+  NATIVE_UINT_TYPE SpscQueue::getCount() const {
+    // Read the head first so the difference is never negative when called
+    // from a third thread; clamp the momentary overshoot that can cause.
+    const U32 head = this->m_head.load(std::memory_order_acquire);
+    const U32 tail = this->m_tail.load(std::memory_order_acquire);
+    const NATIVE_UINT_TYPE count = tail - head;
+    return (count > this->m_depth) ? this->m_depth : count;
+  }
+
+  NATIVE_UINT_TYPE SpscQueue::getMaxCount() const {
+    return this->m_maxCount.load(std::memory_order_relaxed);
+  }
+
+  NATIVE_UINT_TYPE SpscQueue::getMsgSize() const {
+    return this->m_msgSize;
+  }
+
+  NATIVE_UINT_TYPE SpscQueue::getDepth() const {
+    return this->m_depth;
+  }
+}
@@ -0,0 +1,122 @@
+// ======================================================================
+// \title  SpscQueue.hpp
+// \brief  A lock-free single-producer, single-consumer buffer ring.
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef OS_PTHREADS_SPSC_QUEUE_HPP
+#define OS_PTHREADS_SPSC_QUEUE_HPP
+
+#include <Fw/Types/BasicTypes.hpp>
+
+#include <atomic>
+#include <pthread.h>
+
+namespace Os {
+
+  //! \class SpscQueue
+  //! \brief A lock-free ring of fixed size buffers for one sender and one receiver
+  //!
+  //! The producer owns the tail index and the consumer owns the head index, so
+  //! a push or a pop that does not have to wait touches no lock. Messages come
+  //! out in the order they went in; the priority is carried along with each
+  //! message but does not affect ordering. A blocked side sleeps on a condition
+  //! variable, and the other side only takes the wake-up lock when it sees that
+  //! a sleeper has announced itself.
+  class SpscQueue {
+    public:
+    //! \brief SpscQueue constructor
+    //!
+    SpscQueue();
+    //! \brief SpscQueue destructor
+    //!
+    //! Deallocate the ring.
+    //!
+    ~SpscQueue();
+    //! \brief SpscQueue creation
+    //!
+    //! Allocate a ring of "depth" slots each holding up to "msgSize" bytes.
+    //! Must not be called while either side is using the queue.
+    //!
+    //! \param depth the maximum number of buffers to store on queue
+    //! \param msgSize the maximum size of a buffer that can be stored on
+    //! the queue
+    //!
+    bool create(NATIVE_UINT_TYPE depth, NATIVE_UINT_TYPE msgSize);
+    //! \brief push an item onto the queue
+    //!
+    //! Copy a buffer into the next free slot. Only the producer thread may
+    //! call this.
+    //!
+    //! \param buffer the buffer to push onto the queue
+    //! \param size the size of buffer
+    //! \param priority the priority to store alongside the buffer
+    //! \param block wait for a free slot instead of failing when full
+    //! \return true if the buffer was queued, false if the queue was full
+    //!
+    bool push(const U8* buffer, NATIVE_UINT_TYPE size, NATIVE_INT_TYPE priority, bool block);
+    //! \brief pop an item off the queue
+    //!
+    //! Copy the oldest buffer out of the queue. Only the consumer thread may
+    //! call this. On failure "size" is zero if the queue was empty, or the
+    //! size of the waiting message if "buffer" was too small; in the latter
+    //! case the message stays on the queue.
+    //!
+    //! \param buffer the buffer to fill from the queue
+    //! \param size the size of buffer on input, the size of the popped
+    //! buffer on output
+    //! \param priority the priority stored with the popped buffer
+    //! \param block wait for a message instead of failing when empty
+    //!
+    bool pop(U8* buffer, NATIVE_UINT_TYPE& size, NATIVE_INT_TYPE &priority, bool block);
+    //! \brief Get the current number of items on the queue
+    //!
+    NATIVE_UINT_TYPE getCount() const;
+    //! \brief Get the maximum number of items seen on the queue
+    //!
+    NATIVE_UINT_TYPE getMaxCount() const;
+    //! \brief Get the maximum message size
+    //!
+    NATIVE_UINT_TYPE getMsgSize() const;
+    //! \brief Get the queue depth
+    //!
+    NATIVE_UINT_TYPE getDepth() const;
+
+    PRIVATE:
+    // Destroy the ring storage:
+    void finalize();
+    // Address of the slot used by a ring position:
+    U8* getSlot(U32 position) const;
+
+    // Size of one cache line, used to keep the two indices apart:
+    static const NATIVE_UINT_TYPE CACHE_LINE = 64;
+
+    // Producer side:
+    std::atomic<U32> m_tail; // Next position to write
+    U8 m_tailPad[CACHE_LINE - sizeof(std::atomic<U32>)];
+    // Consumer side:
+    std::atomic<U32> m_head; // Next position to read
+    U8 m_headPad[CACHE_LINE - sizeof(std::atomic<U32>)];
+
+    std::atomic<bool> m_consumerWaiting; // Consumer is (about to be) asleep on m_notEmpty
+    std::atomic<bool> m_producerWaiting; // Producer is (about to be) asleep on m_notFull
+    std::atomic<NATIVE_UINT_TYPE> m_maxCount; // High water mark, written by the producer
+
+    U8* m_data; // Ring storage
+    NATIVE_UINT_TYPE m_msgSize; // Max size of message on the queue
+    NATIVE_UINT_TYPE m_depth; // Max number of messages on the queue
+    NATIVE_UINT_TYPE m_slotMask; // Number of slots, a power of two, minus one
+    NATIVE_UINT_TYPE m_slotSize; // Bytes per slot: size, priority, then data
+
+    pthread_mutex_t m_waitLock; // Only taken to sleep or to wake a sleeper
+    pthread_cond_t m_notEmpty;
+    pthread_cond_t m_notFull;
+  };
+}
+
+#endif // OS_PTHREADS_SPSC_QUEUE_HPP
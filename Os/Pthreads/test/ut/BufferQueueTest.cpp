@@ -1,6 +1,8 @@
 #include "Os/Pthreads/BufferQueue.hpp"
+#include <Os/IntervalTimer.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 
 using namespace Os;
@@ -11,6 +13,89 @@ using namespace Os;
 
 #define DEPTH 5
 #define MSG_SIZE 3
+
+#if PRIORITY_QUEUE
+// Push and pop random priorities, checking the queue against a simple model
+// that scans for the highest priority, oldest message. The depth spans more
+// than one bitmap word and more distinct priorities are used than the queue
+// can hold, so levels are created, reused, and reclaimed.
+void testRandomPriorities() {
+  const NATIVE_UINT_TYPE depth = 40;
+  BufferQueue queue;
+  bool ret = queue.create(depth, sizeof(U32));
+  FW_ASSERT(ret, ret);
+
+  NATIVE_INT_TYPE modelPriority[depth];
+  U32 modelSeq[depth];
+  NATIVE_UINT_TYPE modelCount = 0;
+  U32 nextSeq = 0;
+  srand(1);
+
+  for (U32 iter = 0; iter < 200000; ++iter) {
+    const bool doPush = (modelCount == 0) || (modelCount < depth && (rand() % 2) == 0);
+    if (doPush) {
+      const NATIVE_INT_TYPE priority = (rand() % 101) - 50;
+      ret = queue.push(reinterpret_cast<const U8*>(&nextSeq), sizeof(nextSeq), priority);
+      FW_ASSERT(ret, ret);
+      modelPriority[modelCount] = priority;
+      modelSeq[modelCount] = nextSeq;
+      ++modelCount;
+      ++nextSeq;
+    } else {
+      NATIVE_UINT_TYPE best = 0;
+      for (NATIVE_UINT_TYPE ii = 1; ii < modelCount; ++ii) {
+        if (modelPriority[ii] > modelPriority[best] ||
+            (modelPriority[ii] == modelPriority[best] && modelSeq[ii] < modelSeq[best])) {
+          best = ii;
+        }
+      }
+      U32 seq = 0;
+      NATIVE_UINT_TYPE size = sizeof(seq);
+      NATIVE_INT_TYPE priority = 0;
+      ret = queue.pop(reinterpret_cast<U8*>(&seq), size, priority);
+      FW_ASSERT(ret, ret);
+      FW_ASSERT(size == sizeof(seq), size);
+      FW_ASSERT(priority == modelPriority[best], priority, modelPriority[best]);
+      FW_ASSERT(seq == modelSeq[best], seq, modelSeq[best]);
+      --modelCount;
+      modelPriority[best] = modelPriority[modelCount];
+      modelSeq[best] = modelSeq[modelCount];
+    }
+    FW_ASSERT(queue.getCount() == modelCount, queue.getCount(), modelCount);
+  }
+}
+#endif
+
+// Time steady-state push/pop pairs on a half full queue at several depths
+// using the four priorities a typical component queue sees.
+void benchmarkDepths() {
+  const NATIVE_UINT_TYPE depths[] = {10, 100, 1000, 10000};
+  const U32 iterations = 1000000;
+  U8 msg[MSG_SIZE] = {0};
+  for (NATIVE_UINT_TYPE ii = 0; ii < FW_NUM_ARRAY_ELEMENTS(depths); ++ii) {
+    BufferQueue queue;
+    bool ret = queue.create(depths[ii], sizeof(msg));
+    FW_ASSERT(ret, ret);
+    for (NATIVE_UINT_TYPE jj = 0; jj < depths[ii] / 2; ++jj) {
+      ret = queue.push(msg, sizeof(msg), static_cast<NATIVE_INT_TYPE>(jj % 4));
+      FW_ASSERT(ret, ret);
+    }
+    Os::IntervalTimer timer;
+    timer.start();
+    for (U32 jj = 0; jj < iterations; ++jj) {
+      ret = queue.push(msg, sizeof(msg), static_cast<NATIVE_INT_TYPE>(jj % 4));
+      FW_ASSERT(ret, ret);
+      NATIVE_UINT_TYPE size = sizeof(msg);
+      NATIVE_INT_TYPE priority;
+      ret = queue.pop(msg, size, priority);
+      FW_ASSERT(ret, ret);
+    }
+    timer.stop();
+    printf("Depth %5u: %0.3fus per push/pop\n", depths[ii],
+           static_cast<F64>(timer.getDiffUsec()) / iterations);
+  }
+}
+
 int main() {
   printf("Creating queue.\n");
   bool ret;
@@ -132,5 +217,14 @@ int main() {
 
   printf("Passed.\n");
 
+#if PRIORITY_QUEUE
+  printf("Test random priorities...\n");
+  testRandomPriorities();
+  printf("Passed.\n");
+#endif
+
+  printf("Benchmark queue depths...\n");
+  benchmarkDepths();
+
   printf("Test done.\n");
 }
@@ -0,0 +1,83 @@
+// ======================================================================
+// \title  SpscQueueTest.cpp
+// \brief  Unit tests for the lock-free single-producer, single-consumer ring
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Os/Pthreads/SpscQueue.hpp"
+#include <gtest/gtest.h>
+
+// Start both counters at the given position, as if that many messages had
+// already passed through the ring.
+void setPosition(Os::SpscQueue& queue, const U32 position) {
+  queue.m_head.store(position);
+  queue.m_tail.store(position);
+}
+
+// Push "count" numbered messages, then pop them and check their order.
+void pushPopSequence(Os::SpscQueue& queue, const U32 first, const U32 count) {
+  for (U32 ii = 0; ii < count; ii++) {
+    const U32 msg = first + ii;
+    ASSERT_TRUE(queue.push(reinterpret_cast<const U8*>(&msg), sizeof(msg), 0, false));
+  }
+  ASSERT_EQ(count, queue.getCount());
+  for (U32 ii = 0; ii < count; ii++) {
+    U32 msg = 0;
+    NATIVE_UINT_TYPE size = sizeof(msg);
+    NATIVE_INT_TYPE priority = 0;
+    ASSERT_TRUE(queue.pop(reinterpret_cast<U8*>(&msg), size, priority, false));
+    ASSERT_EQ(sizeof(msg), size);
+    ASSERT_EQ(first + ii, msg);
+  }
+  ASSERT_EQ(0U, queue.getCount());
+}
+
+// A depth that is not a power of two must keep FIFO order across the 2^32
+// wrap of the head and tail counters.
+TEST(SpscQueue, CounterWrap) {
+  const NATIVE_UINT_TYPE depths[] = {1, 3, 5, 7, 8, 100};
+  for (NATIVE_UINT_TYPE ii = 0; ii < FW_NUM_ARRAY_ELEMENTS(depths); ii++) {
+    const NATIVE_UINT_TYPE depth = depths[ii];
+    Os::SpscQueue queue;
+    ASSERT_TRUE(queue.create(depth, sizeof(U32)));
+    setPosition(queue, 0xFFFFFFFFU - depth + 1);
+    // Fill the ring so the last message lands on the other side of the wrap
+    pushPopSequence(queue, 1, depth);
+    // Keep the ring partly full while the counters cross the wrap
+    setPosition(queue, 0xFFFFFFFEU);
+    for (U32 round = 0; round < 2 * depth + 2; round++) {
+      pushPopSequence(queue, round * depth, (round % depth) + 1);
+    }
+  }
+}
+
+// The queue is full at its depth even though the ring has more slots.
+TEST(SpscQueue, FullAtDepth) {
+  Os::SpscQueue queue;
+  ASSERT_TRUE(queue.create(3, sizeof(U32)));
+  setPosition(queue, 0xFFFFFFFEU);
+  for (U32 msg = 1; msg <= 3; msg++) {
+    ASSERT_TRUE(queue.push(reinterpret_cast<const U8*>(&msg), sizeof(msg), 0, false));
+  }
+  const U32 extra = 4;
+  ASSERT_FALSE(queue.push(reinterpret_cast<const U8*>(&extra), sizeof(extra), 0, false));
+  ASSERT_EQ(3U, queue.getCount());
+  ASSERT_EQ(3U, queue.getMaxCount());
+  for (U32 expected = 1; expected <= 3; expected++) {
+    U32 msg = 0;
+    NATIVE_UINT_TYPE size = sizeof(msg);
+    NATIVE_INT_TYPE priority = 0;
+    ASSERT_TRUE(queue.pop(reinterpret_cast<U8*>(&msg), size, priority, false));
+    ASSERT_EQ(expected, msg);
+  }
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
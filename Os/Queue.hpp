@@ -42,9 +42,16 @@ namespace Os {
                 QUEUE_NONBLOCKING //!<  Queue receive always returns even if there is no message
             } QueueBlocking;
 
+            typedef enum {
+                QUEUE_SHARED, //!<  Any number of threads may send and receive; messages are ordered by priority
+                QUEUE_SPSC //!<  Exactly one sending and one receiving thread; lock-free, FIFO, priority is passed through but not used for ordering
+            } QueueConcurrency;
+
+            typedef void (*sendNotifier)(void* arg); //!< prototype for a function called after a message is sent
+
             Queue();
             virtual ~Queue();
-            QueueStatus create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize); //!<  create a message queue
+            QueueStatus create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize, QueueConcurrency concurrency = QUEUE_SHARED); //!<  create a message queue
 
             // Send serialized buffers
             QueueStatus send(const Fw::SerializeBufferBase &buffer, NATIVE_INT_TYPE priority, QueueBlocking block); //!<  send a message
@@ -59,6 +66,13 @@ namespace Os {
             NATIVE_INT_TYPE getQueueSize() const; //!< get the queue depth (maximum number of messages queue can hold)
             NATIVE_INT_TYPE getMsgSize() const; //!< get the message size (maximum message size queue can hold)
             const QueueString& getName(); //!< get the queue name
+
+            //! Set a function to be called on the sending thread each time a message is placed on the queue. It is
+            //! called after the message can be received, so it must not block or send to this queue. Used to hand the
+            //! queue to a scheduler instead of leaving a thread blocked on it.
+            //! \param notifier: function to call, or nullptr to stop notifications
+            //! \param arg: argument passed to the function
+            void setSendNotifier(sendNotifier notifier, void* arg);
             static NATIVE_INT_TYPE getNumQueues(); //!< get the number of queues in the system
 #if FW_QUEUE_REGISTRATION
             static void setQueueRegistry(QueueRegistry* reg); // !< set the queue registry
@@ -70,10 +84,15 @@ namespace Os {
             //! \param name: name of queue
             //! \param depth: depth of queue
             //! \param msgSize: size of a message stored on queue
+            //! \param concurrency: access pattern the queue will be used with. Backends without a specialized
+            //!        single-producer single-consumer implementation may treat QUEUE_SPSC as QUEUE_SHARED.
             //! \return queue creation status
-            QueueStatus createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize); //!<  create a message queue
+            QueueStatus createInternal(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize, QueueConcurrency concurrency); //!<  create a message queue
+            void notifySent(); //!< call the send notifier, if one is set. Called by implementations after a successful send
             POINTER_CAST m_handle; //!<  handle for implementation specific queue
             QueueString m_name; //!< queue name
+            sendNotifier m_sendNotifier; //!< function called after a successful send
+            void* m_sendNotifierArg; //!< argument passed to the send notifier
 #if FW_QUEUE_REGISTRATION
             static QueueRegistry* s_queueRegistry; //!< pointer to registry
 #endif
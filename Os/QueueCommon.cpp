@@ -38,10 +38,10 @@ namespace Os {
         }
     }
 
-    Queue::QueueStatus Queue::create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize) {
+    Queue::QueueStatus Queue::create(const Fw::StringBase &name, NATIVE_INT_TYPE depth, NATIVE_INT_TYPE msgSize, QueueConcurrency concurrency) {
         FW_ASSERT(depth > 0, depth);
         FW_ASSERT(msgSize > 0, depth);
-        return createInternal(name, depth, msgSize);
+        return createInternal(name, depth, msgSize, concurrency);
     }
 
 
@@ -62,4 +62,15 @@ namespace Os {
         return this->m_name;
     }
 
+    void Queue::setSendNotifier(sendNotifier notifier, void* arg) {
+        this->m_sendNotifierArg = arg;
+        this->m_sendNotifier = notifier;
+    }
+
+    void Queue::notifySent() {
+        if (this->m_sendNotifier != nullptr) {
+            this->m_sendNotifier(this->m_sendNotifierArg);
+        }
+    }
+
 }
@@ -58,6 +58,10 @@ namespace Os {
         Status createValidation(const char* fileName, const char* hashFileName);   //!< Create a validation of the file 'fileName' and store it in
                                                                                              //!< in a file 'hashFileName'
 
+        // for writers that hash their data as they write it
+        Status writeValidation(const char* hashFileName, const Utils::HashBuffer &hashBuffer); //!< Store an already computed hash in
+                                                                                                  //!< a file 'hashFileName'
+
     }
 }
 
@@ -48,6 +48,18 @@ namespace Os {
     return status;
   }
 
+  Os::ValidateFile::Status ValidatedFile ::
+    createHashFile(const Utils::HashBuffer& hashBuffer)
+  {
+    this->hashBuffer = hashBuffer;
+    const Os::ValidateFile::Status status =
+      Os::ValidateFile::writeValidation(
+         this->hashFileName.toChar(),
+         this->hashBuffer
+      );
+    return status;
+  }
+
   const Fw::StringBase& ValidatedFile ::
     getFileName() const
   {
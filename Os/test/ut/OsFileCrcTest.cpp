@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+#include <Os/File.hpp>
+#include <Os/FileSystem.hpp>
+#include <Os/IntervalTimer.hpp>
+#include <Fw/Types/Assert.hpp>
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include <Utils/Hash/libcrc/lib_crc.h> // reference CRC
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#include <cstdio>
+
+namespace {
+
+const char crcFileName[] = "crc_test_file";
+
+// Write "size" bytes of a fixed pseudo-random pattern to the test file and
+// return the CRC of the pattern computed one byte at a time.
+U32 writePatternFile(U32 size) {
+    Os::File file;
+    U8 buffer[1024];
+    U32 seed = 0xFFFFFFFF;
+    U32 state = size;
+
+    EXPECT_EQ(file.open(crcFileName, Os::File::OPEN_WRITE), Os::File::OP_OK);
+    U32 remaining = size;
+    while (remaining > 0) {
+        NATIVE_INT_TYPE chunk = (remaining < sizeof(buffer)) ? static_cast<NATIVE_INT_TYPE>(remaining) : static_cast<NATIVE_INT_TYPE>(sizeof(buffer));
+        for (NATIVE_INT_TYPE ii = 0; ii < chunk; ii++) {
+            state = state * 1664525 + 1013904223;
+            buffer[ii] = static_cast<U8>(state >> 24);
+            seed = update_crc_32(seed, static_cast<char>(buffer[ii]));
+        }
+        NATIVE_INT_TYPE written = chunk;
+        EXPECT_EQ(file.write(buffer, written), Os::File::OP_OK);
+        EXPECT_EQ(written, chunk);
+        remaining -= static_cast<U32>(chunk);
+    }
+    file.close();
+    return seed;
+}
+
+U32 fileCrc(Os::File::Status& status) {
+    Os::File file;
+    U32 crc = 0;
+    status = file.open(crcFileName, Os::File::OPEN_READ);
+    if (status == Os::File::OP_OK) {
+        status = file.calculateCRC32(crc);
+        file.close();
+    }
+    return crc;
+}
+
+}
+
+extern "C" {
+    void fileCrcTest();
+}
+
+void fileCrcTest() {
+    Os::File::Status status;
+
+    printf("Checking CRC of files around the read chunk size\n");
+    const U32 sizes[] = {0, 1, 31, FW_FILE_CRC_CHUNK_SIZE - 1, FW_FILE_CRC_CHUNK_SIZE, FW_FILE_CRC_CHUNK_SIZE + 1, 3 * FW_FILE_CRC_CHUNK_SIZE + 7};
+    for (U32 ii = 0; ii < FW_NUM_ARRAY_ELEMENTS(sizes); ii++) {
+        const U32 expected = writePatternFile(sizes[ii]);
+        const U32 crc = fileCrc(status);
+        ASSERT_EQ(status, Os::File::OP_OK);
+        ASSERT_EQ(crc, expected) << "size " << sizes[ii];
+        U32 niceCrc = 0;
+        ASSERT_EQ(Os::File::niceCRC32(niceCrc, crcFileName), Os::File::OP_OK);
+        ASSERT_EQ(niceCrc, expected) << "size " << sizes[ii];
+    }
+
+    printf("Checking CRC of unopened file\n");
+    Os::File unopened;
+    U32 crc = 1;
+    ASSERT_EQ(unopened.calculateCRC32(crc), Os::File::NOT_OPENED);
+    ASSERT_EQ(crc, 0U);
+
+    // Throughput of the streaming CRC on a file that is already in the page cache
+    const U32 benchSize = 16 * 1024 * 1024;
+    const U32 expected = writePatternFile(benchSize);
+    (void) fileCrc(status);
+    Os::IntervalTimer timer;
+    timer.start();
+    crc = fileCrc(status);
+    timer.stop();
+    ASSERT_EQ(status, Os::File::OP_OK);
+    ASSERT_EQ(crc, expected);
+    const U32 usec = timer.getDiffUsec();
+    printf("calculateCRC32 of %u bytes: %u us (%0.1f MB/s)\n", benchSize, usec,
+           static_cast<F64>(benchSize) / ((usec > 0) ? static_cast<F64>(usec) : 1.0));
+
+    ASSERT_EQ(Os::FileSystem::removeFile(crcFileName), Os::FileSystem::OP_OK);
+}
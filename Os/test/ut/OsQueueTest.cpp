@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <Os/Queue.hpp>
+#include <Os/IntervalTimer.hpp>
 #include <cstdio>
 #include <cstring>
 #include <Fw/Types/Assert.hpp>
@@ -34,9 +35,9 @@ class MyTestSerializedBuffer : public Fw::SerializeBufferBase {
         U8 m_someBuffer[SER_BUFFER_SIZE];
 };
 
-Os::Queue* createTestQueue(const char *name, U32 size, I32 depth) {
+Os::Queue* createTestQueue(const char *name, U32 size, I32 depth, Os::Queue::QueueConcurrency concurrency = Os::Queue::QUEUE_SHARED) {
     Os::Queue* testQueue = new Os::Queue();
-    Os::Queue::QueueStatus stat = testQueue->create(Os::QueueString(name), depth, size);
+    Os::Queue::QueueStatus stat = testQueue->create(Os::QueueString(name), depth, size, concurrency);
     EXPECT_EQ(stat,Os::Queue::QUEUE_OK);
 
     // Make sure the queue is of the correct size:
@@ -124,6 +125,8 @@ extern "C" {
     void qtest_nonblock_send();
     void qtest_block_send();
     void qtest_concurrent();
+    void qtest_spsc();
+    void qtest_spsc_performance();
 }
 
 // Alarm signal handler for waking up a blocked queue:
@@ -595,3 +598,183 @@ void qtest_concurrent() {
     printf("---------------------\n");
     printf("---------------------\n");
 }
+
+// Producer side of the SPSC tests: sends numbered messages with blocking sends.
+// All messages share one priority so the shared queue also delivers them in order.
+struct SpscArgs {
+    Os::Queue* queue;
+    U32 count;
+};
+
+void *run_spsc_producer(void *ptr)
+{
+  SpscArgs* args = static_cast<SpscArgs*>(ptr);
+  U8 msg[SER_BUFFER_SIZE];
+  memset(msg, 0, sizeof(msg));
+  for (U32 ii = 0; ii < args->count; ii++) {
+    memcpy(msg, &ii, sizeof(ii));
+    Os::Queue::QueueStatus stat = args->queue->send(msg, sizeof(msg), 0, Os::Queue::QUEUE_BLOCKING);
+    EXPECT_EQ(stat, Os::Queue::QUEUE_OK);
+  }
+  return nullptr;
+}
+
+// Receives the numbered messages sent by run_spsc_producer and checks their order.
+void receiveSequence(Os::Queue* queue, U32 count) {
+  U8 msg[SER_BUFFER_SIZE];
+  NATIVE_INT_TYPE size;
+  NATIVE_INT_TYPE prio;
+  for (U32 ii = 0; ii < count; ii++) {
+    Os::Queue::QueueStatus stat = queue->receive(msg, sizeof(msg), size, prio, Os::Queue::QUEUE_BLOCKING);
+    ASSERT_EQ(stat, Os::Queue::QUEUE_OK);
+    ASSERT_EQ(size, static_cast<NATIVE_INT_TYPE>(sizeof(msg)));
+    U32 seq;
+    memcpy(&seq, msg, sizeof(seq));
+    ASSERT_EQ(seq, ii);
+  }
+}
+
+// This test checks the single-producer, single-consumer queue:
+void qtest_spsc() {
+    printf("---------------------\n");
+    printf("----  spsc test  ----\n");
+    printf("---------------------\n");
+    Os::Queue* testQueue = createTestQueue("TestQ", SER_BUFFER_SIZE, QUEUE_SIZE, Os::Queue::QUEUE_SPSC);
+    Os::Queue::QueueStatus stat;
+    MyTestSerializedBuffer recvBuff;
+    I32 prio;
+
+    printf("Testing empty queue...\n");
+    stat = testQueue->receive(recvBuff, prio, Os::Queue::QUEUE_NONBLOCKING);
+    ASSERT_EQ(stat, Os::Queue::QUEUE_NO_MORE_MSGS);
+
+    printf("Testing FIFO order and full queue...\n");
+    for (I32 ii = 0; ii < QUEUE_SIZE; ii++) {
+        MyTestSerializedBuffer sendBuff = getSendBuffer(ii);
+        stat = testQueue->send(sendBuff, ii%4, Os::Queue::QUEUE_NONBLOCKING);
+        ASSERT_EQ(stat, Os::Queue::QUEUE_OK);
+    }
+    MyTestSerializedBuffer extraBuff = getSendBuffer(0);
+    stat = testQueue->send(extraBuff, 0, Os::Queue::QUEUE_NONBLOCKING);
+    ASSERT_EQ(stat, Os::Queue::QUEUE_FULL);
+    ASSERT_EQ(testQueue->getNumMsgs(), QUEUE_SIZE);
+    ASSERT_EQ(testQueue->getMaxMsgs(), QUEUE_SIZE);
+
+    printf("Testing undersized receive buffer...\n");
+    U8 small[1];
+    NATIVE_INT_TYPE size;
+    stat = testQueue->receive(small, sizeof(small), size, prio, Os::Queue::QUEUE_NONBLOCKING);
+    ASSERT_EQ(stat, Os::Queue::QUEUE_SIZE_MISMATCH);
+    ASSERT_EQ(testQueue->getNumMsgs(), QUEUE_SIZE);
+
+    // Priority is passed through but does not reorder messages:
+    for (I32 ii = 0; ii < QUEUE_SIZE; ii++) {
+        MyTestSerializedBuffer sendBuff = getSendBuffer(ii);
+        stat = testQueue->receive(recvBuff, prio, Os::Queue::QUEUE_NONBLOCKING);
+        ASSERT_EQ(stat, Os::Queue::QUEUE_OK);
+        ASSERT_EQ(prio, ii%4);
+        compareBuffers(sendBuff, recvBuff);
+    }
+    ASSERT_EQ(testQueue->getNumMsgs(), 0);
+    ASSERT_EQ(testQueue->getMaxMsgs(), QUEUE_SIZE);
+
+    printf("Testing blocking send and receive across threads...\n");
+    SpscArgs args;
+    args.queue = testQueue;
+    args.count = 100000;
+    pthread_t thread;
+    ASSERT_EQ(pthread_create(&thread, nullptr, run_spsc_producer, &args), 0);
+    receiveSequence(testQueue, args.count);
+    ASSERT_EQ(pthread_join(thread, nullptr), 0);
+    ASSERT_EQ(testQueue->getNumMsgs(), 0);
+
+    delete testQueue;
+    printf("Test complete.\n");
+    printf("---------------------\n");
+    printf("---------------------\n");
+}
+
+// Echo side of the latency test: returns every message from one queue on another.
+struct EchoArgs {
+    Os::Queue* request;
+    Os::Queue* reply;
+    U32 count;
+};
+
+void *run_echo(void *ptr)
+{
+  EchoArgs* args = static_cast<EchoArgs*>(ptr);
+  U8 msg[SER_BUFFER_SIZE];
+  NATIVE_INT_TYPE size;
+  NATIVE_INT_TYPE prio;
+  for (U32 ii = 0; ii < args->count; ii++) {
+    Os::Queue::QueueStatus stat = args->request->receive(msg, sizeof(msg), size, prio, Os::Queue::QUEUE_BLOCKING);
+    EXPECT_EQ(stat, Os::Queue::QUEUE_OK);
+    stat = args->reply->send(msg, size, prio, Os::Queue::QUEUE_BLOCKING);
+    EXPECT_EQ(stat, Os::Queue::QUEUE_OK);
+  }
+  return nullptr;
+}
+
+// This test compares the throughput and latency of the shared and SPSC queues
+// with one sending and one receiving thread:
+void qtest_spsc_performance() {
+    printf("---------------------------------\n");
+    printf("---- spsc performance test ------\n");
+    printf("---------------------------------\n");
+    const Os::Queue::QueueConcurrency modes[] = {Os::Queue::QUEUE_SHARED, Os::Queue::QUEUE_SPSC};
+    const char* names[] = {"shared", "spsc"};
+    const U32 throughputMsgs = 1000000;
+    const U32 roundTrips = 100000;
+
+    for (U32 mode = 0; mode < FW_NUM_ARRAY_ELEMENTS(modes); mode++) {
+        Os::IntervalTimer timer;
+        pthread_t thread;
+
+        // Throughput: stream messages through a queue as fast as the consumer keeps up
+        Os::Queue* testQueue = createTestQueue("TestQ", SER_BUFFER_SIZE, 100, modes[mode]);
+        SpscArgs args;
+        args.queue = testQueue;
+        args.count = throughputMsgs;
+        timer.start();
+        ASSERT_EQ(pthread_create(&thread, nullptr, run_spsc_producer, &args), 0);
+        receiveSequence(testQueue, throughputMsgs);
+        ASSERT_EQ(pthread_join(thread, nullptr), 0);
+        timer.stop();
+        const F64 streamUs = static_cast<F64>(timer.getDiffUsec());
+        delete testQueue;
+
+        // Latency: bounce one message at a time between two threads
+        Os::Queue* request = createTestQueue("ReqQ", SER_BUFFER_SIZE, 10, modes[mode]);
+        Os::Queue* reply = createTestQueue("RepQ", SER_BUFFER_SIZE, 10, modes[mode]);
+        EchoArgs echo;
+        echo.request = request;
+        echo.reply = reply;
+        echo.count = roundTrips;
+        U8 msg[SER_BUFFER_SIZE];
+        memset(msg, 0, sizeof(msg));
+        NATIVE_INT_TYPE size;
+        NATIVE_INT_TYPE prio;
+        timer.start();
+        ASSERT_EQ(pthread_create(&thread, nullptr, run_echo, &echo), 0);
+        for (U32 ii = 0; ii < roundTrips; ii++) {
+            ASSERT_EQ(request->send(msg, sizeof(msg), 0, Os::Queue::QUEUE_BLOCKING), Os::Queue::QUEUE_OK);
+            ASSERT_EQ(reply->receive(msg, sizeof(msg), size, prio, Os::Queue::QUEUE_BLOCKING), Os::Queue::QUEUE_OK);
+        }
+        ASSERT_EQ(pthread_join(thread, nullptr), 0);
+        timer.stop();
+        const F64 pingUs = static_cast<F64>(timer.getDiffUsec());
+        delete request;
+        delete reply;
+
+        printf("%-6s throughput: %0.0f msgs/s (%0.3fus per) round trip: %0.3fus\n",
+            names[mode],
+            1000000.0 * throughputMsgs / streamUs,
+            streamUs / throughputMsgs,
+            pingUs / roundTrips);
+    }
+
+    printf("Test complete.\n");
+    printf("---------------------------------\n");
+    printf("---------------------------------\n");
+}
@@ -11,9 +11,12 @@ extern "C" {
   void qtest_block_send();
   void qtest_performance();
   void qtest_concurrent();
+  void qtest_spsc();
+  void qtest_spsc_performance();
   void intervalTimerTest();
   void fileSystemTest();
   void validateFileTest(const char* filename);
+  void fileCrcTest();
   void systemResourcesTest();
   void mutexBasicLockableTest();
 }
@@ -39,6 +42,12 @@ TEST(Nominal, QTestPerformance) {
 TEST(Nominal, QTestConcurrentTest) {
    qtest_concurrent();
 }
+TEST(Nominal, QTestSpsc) {
+   qtest_spsc();
+}
+TEST(Nominal, QTestSpscPerformance) {
+   qtest_spsc_performance();
+}
 
 // The interval timer unit test is timed off a 1 sec thread delay. Mac OS allows a large amount of
 // scheduling jitter to conserve energy, which rarely causes this sleep to be slightly shorter
@@ -54,6 +63,9 @@ TEST(Nominal, FileSystemTest) {
 TEST(Nominal, ValidateFileTest) {
    validateFileTest(filename);
 }
+TEST(Nominal, FileCrcTest) {
+   fileCrcTest();
+}
 TEST(Nominal, SystemResourcesTest) { 
    systemResourcesTest();
 }
@@ -549,6 +549,10 @@ namespace Ref {
           0,
           comm.get_send_InputPort(0)
       );
+      downlink.set_framedGatherOut_OutputPort(
+          0,
+          comm.get_sendGather_InputPort(0)
+      );
       eventLogger.set_PktSend_OutputPort(
           0,
           downlink.get_comIn_InputPort(0)
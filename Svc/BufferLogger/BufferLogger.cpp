@@ -23,7 +23,11 @@ namespace Svc {
       BufferLogger(const char *const compName) :
           BufferLoggerComponentBase(compName),
           m_state(LogState::LOGGING_ON),
-          m_file(*this)
+          m_file(*this),
+          m_writeBehind(false),
+          m_writeQueueStalls(0),
+          m_numLoggedBuffers(0),
+          m_maxWriteLatency(0)
   {
 
   }
@@ -53,6 +57,54 @@ namespace Svc {
       m_file.init(logFilePrefix, logFileSuffix, maxFileSize, sizeOfSize);
   }
 
+  void BufferLogger ::
+    startWriteBehindTask(
+        const Fw::StringBase& name,
+        const NATIVE_INT_TYPE queueDepth,
+        const NATIVE_UINT_TYPE priority,
+        const NATIVE_UINT_TYPE stack,
+        const NATIVE_UINT_TYPE cpuAffinity
+    )
+  {
+    FW_ASSERT(not m_writeBehind); // It is a coding error to start this task multiple times
+    // Only the component thread queues requests, and only this task
+    // takes them off
+    const Os::Queue::QueueStatus queueStatus = m_writeQueue.create(
+        name,
+        queueDepth,
+        WriteRequest::SERIALIZED_SIZE,
+        Os::Queue::QUEUE_SPSC
+    );
+    FW_ASSERT(Os::Queue::QUEUE_OK == queueStatus, static_cast<NATIVE_INT_TYPE>(queueStatus));
+    m_writeBehind = true;
+    const Os::Task::TaskStatus taskStatus = m_writeBehindTask.start(
+        name,
+        BufferLogger::writeBehindTask,
+        this,
+        priority,
+        stack,
+        cpuAffinity
+    );
+    FW_ASSERT(Os::Task::TASK_OK == taskStatus, static_cast<NATIVE_INT_TYPE>(taskStatus));
+  }
+
+  void BufferLogger ::
+    stopWriteBehindTask()
+  {
+    FW_ASSERT(m_writeBehind);
+    WriteRequest request;
+    this->initWriteRequest(request, WriteRequestKind::STOP);
+    this->sendWriteRequest(request);
+  }
+
+  Os::Task::TaskStatus BufferLogger ::
+    joinWriteBehindTask(void** value_ptr)
+  {
+    const Os::Task::TaskStatus status = m_writeBehindTask.join(value_ptr);
+    m_writeBehind = false;
+    return status;
+  }
+
   // ----------------------------------------------------------------------
   // Handler implementations for user-defined typed input ports
   // ----------------------------------------------------------------------
@@ -64,9 +116,22 @@ namespace Svc {
     )
   {
     if (m_state == LogState::LOGGING_ON) {
+      if (m_writeBehind) {
+        // The task returns the buffer once it is written
+        WriteRequest request;
+        this->initWriteRequest(request, WriteRequestKind::LOG_BUFFER);
+        const Fw::SerializeStatus status = request.serialize(fwBuffer);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+        this->sendWriteRequest(request);
+        return;
+      }
       const U8 *const addr = fwBuffer.getData();
       const U32 size = fwBuffer.getSize();
-      m_file.logBuffer(addr, size);
+      if (m_file.logBuffer(addr, size)) {
+        Os::IntervalTimer::RawTime now;
+        Os::IntervalTimer::getRawTime(now);
+        this->updateLogStats(now);
+      }
     }
     this->bufferSendOut_out(0, fwBuffer);
   }
@@ -79,9 +144,21 @@ namespace Svc {
     )
   {
     if (m_state == LogState::LOGGING_ON) {
+      if (m_writeBehind) {
+        WriteRequest request;
+        this->initWriteRequest(request, WriteRequestKind::LOG_COM);
+        const Fw::SerializeStatus status = request.serialize(data);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+        this->sendWriteRequest(request);
+        return;
+      }
       const U8 *const addr = data.getBuffAddr();
       const U32 size = data.getBuffLength();
-      m_file.logBuffer(addr, size);
+      if (m_file.logBuffer(addr, size)) {
+        Os::IntervalTimer::RawTime now;
+        Os::IntervalTimer::getRawTime(now);
+        this->updateLogStats(now);
+      }
     }
   }
 
@@ -97,7 +174,21 @@ namespace Svc {
         NATIVE_UINT_TYPE context
     )
   {
-    // TODO
+    U32 numLoggedBuffers;
+    U32 maxWriteLatency;
+    m_statsLock.lock();
+    numLoggedBuffers = m_numLoggedBuffers;
+    maxWriteLatency = m_maxWriteLatency;
+    m_maxWriteLatency = 0;
+    m_statsLock.unLock();
+
+    this->tlmWrite_BufferLogger_NumLoggedBuffers(numLoggedBuffers);
+    if (m_writeBehind) {
+      this->tlmWrite_BufferLogger_WriteQueueDepth(m_writeQueue.getNumMsgs());
+      this->tlmWrite_BufferLogger_WriteQueueHighWater(m_writeQueue.getMaxMsgs());
+      this->tlmWrite_BufferLogger_WriteQueueStalls(m_writeQueueStalls);
+      this->tlmWrite_BufferLogger_MaxWriteLatency(maxWriteLatency);
+    }
   }
 
   // ----------------------------------------------------------------------
@@ -112,6 +203,14 @@ namespace Svc {
         const Fw::CmdStringArg& file
     )
   {
+    if (m_writeBehind) {
+      WriteRequest request;
+      this->initWriteRequest(request, WriteRequestKind::OPEN_FILE, opCode, cmdSeq, true);
+      const Fw::SerializeStatus status = request.serialize(file);
+      FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+      this->sendWriteRequest(request);
+      return;
+    }
     m_file.setBaseName(file);
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
   }
@@ -122,6 +221,12 @@ namespace Svc {
         const U32 cmdSeq
     )
   {
+    if (m_writeBehind) {
+      WriteRequest request;
+      this->initWriteRequest(request, WriteRequestKind::CLOSE_FILE, opCode, cmdSeq, true);
+      this->sendWriteRequest(request);
+      return;
+    }
     m_file.closeAndEmitEvent();
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
   }
@@ -135,7 +240,15 @@ namespace Svc {
   {
     m_state = state;
     if (state == LogState::LOGGING_OFF) {
-      m_file.closeAndEmitEvent();
+      if (m_writeBehind) {
+        // Buffers already queued are still written before the close
+        WriteRequest request;
+        this->initWriteRequest(request, WriteRequestKind::CLOSE_FILE);
+        this->sendWriteRequest(request);
+      }
+      else {
+        m_file.closeAndEmitEvent();
+      }
     }
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
   }
@@ -146,6 +259,12 @@ namespace Svc {
         const U32 cmdSeq
     )
   {
+    if (m_writeBehind) {
+      WriteRequest request;
+      this->initWriteRequest(request, WriteRequestKind::FLUSH_FILE, opCode, cmdSeq, true);
+      this->sendWriteRequest(request);
+      return;
+    }
     const bool status = m_file.flush();
     if(status)
     {
@@ -157,4 +276,151 @@ namespace Svc {
     }
   }
 
+  // ----------------------------------------------------------------------
+  // Write-behind task
+  // ----------------------------------------------------------------------
+
+  void BufferLogger ::
+    initWriteRequest(
+        WriteRequest& request,
+        const WriteRequestKind::t kind,
+        const FwOpcodeType opCode,
+        const U32 cmdSeq,
+        const bool respond
+    )
+  {
+    Os::IntervalTimer::RawTime now;
+    Os::IntervalTimer::getRawTime(now);
+    request.resetSer();
+    Fw::SerializeStatus status = request.serialize(static_cast<U8>(kind));
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.serialize(opCode);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.serialize(cmdSeq);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.serialize(respond);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.serialize(now.upper);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.serialize(now.lower);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+  }
+
+  void BufferLogger ::
+    sendWriteRequest(const WriteRequest& request)
+  {
+    Os::Queue::QueueStatus status =
+      m_writeQueue.send(request, 0, Os::Queue::QUEUE_NONBLOCKING);
+    if (Os::Queue::QUEUE_FULL == status) {
+      // Back pressure: hold the component thread until the task catches up
+      ++m_writeQueueStalls;
+      status = m_writeQueue.send(request, 0, Os::Queue::QUEUE_BLOCKING);
+    }
+    FW_ASSERT(Os::Queue::QUEUE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+  }
+
+  bool BufferLogger ::
+    doWriteRequest()
+  {
+    WriteRequest request;
+    NATIVE_INT_TYPE priority = 0;
+    const Os::Queue::QueueStatus queueStatus =
+      m_writeQueue.receive(request, priority, Os::Queue::QUEUE_BLOCKING);
+    FW_ASSERT(Os::Queue::QUEUE_OK == queueStatus, static_cast<NATIVE_INT_TYPE>(queueStatus));
+
+    U8 kind = 0;
+    FwOpcodeType opCode = 0;
+    U32 cmdSeq = 0;
+    bool respond = false;
+    Os::IntervalTimer::RawTime queueTime;
+    Fw::SerializeStatus status = request.deserialize(kind);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.deserialize(opCode);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.deserialize(cmdSeq);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.deserialize(respond);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.deserialize(queueTime.upper);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+    status = request.deserialize(queueTime.lower);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+
+    Fw::CmdResponse response = Fw::CmdResponse::OK;
+    bool stop = false;
+    switch (kind) {
+      case WriteRequestKind::LOG_BUFFER: {
+        Fw::Buffer fwBuffer;
+        status = request.deserialize(fwBuffer);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+        if (m_file.logBuffer(fwBuffer.getData(), fwBuffer.getSize())) {
+          this->updateLogStats(queueTime);
+        }
+        // Returned once written to the file; it is not synced first
+        this->bufferSendOut_out(0, fwBuffer);
+        break;
+      }
+      case WriteRequestKind::LOG_COM: {
+        Fw::ComBuffer data;
+        status = request.deserialize(data);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+        if (m_file.logBuffer(data.getBuffAddr(), data.getBuffLength())) {
+          this->updateLogStats(queueTime);
+        }
+        break;
+      }
+      case WriteRequestKind::OPEN_FILE: {
+        Fw::CmdStringArg file;
+        status = request.deserialize(file);
+        FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<NATIVE_INT_TYPE>(status));
+        m_file.setBaseName(file);
+        break;
+      }
+      case WriteRequestKind::CLOSE_FILE:
+        m_file.closeAndEmitEvent();
+        break;
+      case WriteRequestKind::FLUSH_FILE:
+        if (not m_file.flush()) {
+          response = Fw::CmdResponse::EXECUTION_ERROR;
+        }
+        break;
+      case WriteRequestKind::STOP:
+        stop = true;
+        break;
+      default:
+        FW_ASSERT(0, kind);
+        break;
+    }
+
+    if (respond) {
+      this->cmdResponse_out(opCode, cmdSeq, response);
+    }
+    return stop;
+  }
+
+  void BufferLogger ::
+    updateLogStats(const Os::IntervalTimer::RawTime& queueTime)
+  {
+    Os::IntervalTimer::RawTime now;
+    Os::IntervalTimer::getRawTime(now);
+    const U32 latency = Os::IntervalTimer::getDiffUsec(now, queueTime);
+    m_statsLock.lock();
+    ++m_numLoggedBuffers;
+    if (latency > m_maxWriteLatency) {
+      m_maxWriteLatency = latency;
+    }
+    m_statsLock.unLock();
+  }
+
+  void BufferLogger ::
+    writeBehindTask(void* pointer)
+  {
+    FW_ASSERT(pointer);
+    BufferLogger* self = static_cast<BufferLogger*>(pointer);
+    bool stop = false;
+    while (not stop) {
+      stop = self->doWriteRequest();
+    }
+  }
+
 };
@@ -18,6 +18,9 @@
 #include "Fw/Types/String.hpp"
 #include "Fw/Types/Assert.hpp"
 #include "Os/Mutex.hpp"
+#include "Os/Queue.hpp"
+#include "Os/Task.hpp"
+#include "Os/IntervalTimer.hpp"
 #include "Utils/Hash/Hash.hpp"
 
 namespace Svc {
@@ -71,7 +74,8 @@ namespace Svc {
           );
 
           //! Log a buffer
-          void logBuffer(
+          //! \return Whether the buffer was written
+          bool logBuffer(
               const U8 *const data, //!< The buffer data
               const U32 size //!< The size
           );
@@ -148,6 +152,12 @@ namespace Svc {
           //! The number of bytes written to the current file
           U32 bytesWritten;
 
+          //! The running hash of the bytes written to the current file
+          Utils::Hash hash;
+
+          //! Whether every byte of the current file went through the hash
+          bool hashValid;
+
       }; // class File
 
     public:
@@ -179,6 +189,31 @@ namespace Svc {
           const U8 sizeOfSize //!< The number of bytes to use when storing the size field at the start of each buffer
       );
 
+      //! Start the write-behind task. From then on buffers and file
+      //! commands are queued for the task, which writes the files and
+      //! returns each buffer on bufferSendOut once it has been written to
+      //! the file (no sync is done, so the data may not yet be durable), so a
+      //! slow device no longer holds up the component queue. When the
+      //! write queue is full the component waits for room.
+      //! Call after initLog and before the component thread starts.
+      void startWriteBehindTask(
+          const Fw::StringBase& name, //!< The task name
+          const NATIVE_INT_TYPE queueDepth, //!< The maximum number of requests waiting to be written
+          const NATIVE_UINT_TYPE priority = Os::Task::TASK_DEFAULT, //!< The task priority
+          const NATIVE_UINT_TYPE stack = Os::Task::TASK_DEFAULT, //!< The task stack size
+          const NATIVE_UINT_TYPE cpuAffinity = Os::Task::TASK_DEFAULT //!< The task cpu affinity
+      );
+
+      //! Stop the write-behind task once it has written every queued
+      //! request. Call after the component thread has exited.
+      void stopWriteBehindTask();
+
+      //! Wait for the write-behind task to exit
+      //! \return The status of the Os::Task::join call
+      Os::Task::TaskStatus joinWriteBehindTask(
+          void** value_ptr //!< Filled with the task exit value; nullptr to ignore
+      );
+
     PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -250,6 +285,88 @@ namespace Svc {
           const U32 cmdSeq /*!< The command sequence number*/
       );
 
+    PRIVATE:
+
+      // ----------------------------------------------------------------------
+      // Write-behind task
+      // ----------------------------------------------------------------------
+
+      //! The kinds of request handed to the write-behind task
+      struct WriteRequestKind {
+        typedef enum {
+          LOG_BUFFER, //!< Log an Fw::Buffer, then return it
+          LOG_COM, //!< Log a copy of a com buffer
+          OPEN_FILE, //!< Set the base name and open a new file
+          CLOSE_FILE, //!< Close the file
+          FLUSH_FILE, //!< Flush the file
+          STOP //!< Exit the task
+        } t;
+      };
+
+      //! A serialized request for the write-behind task
+      class WriteRequest :
+        public Fw::SerializeBufferBase
+      {
+
+        public:
+
+          enum {
+            SERIALIZED_SIZE =
+              sizeof(U8) + // kind
+              sizeof(FwOpcodeType) + sizeof(U32) + sizeof(U8) + // command opcode, sequence and whether to respond
+              2 * sizeof(U32) + // time the request was queued
+              sizeof(FwBuffSizeType) + FW_COM_BUFFER_MAX_SIZE + // com buffer
+              sizeof(FwBuffSizeType) + FW_CMD_STRING_MAX_SIZE + // base name
+              Fw::Buffer::SERIALIZED_SIZE
+          };
+
+          NATIVE_UINT_TYPE getBuffCapacity() const {
+            return sizeof(this->m_data);
+          }
+
+          U8* getBuffAddr() {
+            return this->m_data;
+          }
+
+          const U8* getBuffAddr() const {
+            return this->m_data;
+          }
+
+        private:
+
+          U8 m_data[SERIALIZED_SIZE];
+
+      };
+
+      //! Start a request with its header
+      void initWriteRequest(
+          WriteRequest& request, //!< The request
+          const WriteRequestKind::t kind, //!< The request kind
+          const FwOpcodeType opCode = 0, //!< The opcode of the command to respond to
+          const U32 cmdSeq = 0, //!< The sequence number of the command to respond to
+          const bool respond = false //!< Whether to send the command response
+      );
+
+      //! Queue a request for the write-behind task, waiting for room if
+      //! the queue is full
+      void sendWriteRequest(
+          const WriteRequest& request //!< The request
+      );
+
+      //! Receive and handle one request on the write-behind task
+      //! \return Whether the task should exit
+      bool doWriteRequest();
+
+      //! Record that a buffer has been logged
+      void updateLogStats(
+          const Os::IntervalTimer::RawTime& queueTime //!< When the buffer was received
+      );
+
+      //! The write-behind task entry point
+      static void writeBehindTask(
+          void* pointer //!< The BufferLogger
+      );
+
   PRIVATE:
 
       // ----------------------------------------------------------------------
@@ -262,6 +379,28 @@ namespace Svc {
       //! The file
       File m_file;
 
+      //! Whether requests go through the write-behind task
+      bool m_writeBehind;
+
+      //! The write-behind task
+      Os::Task m_writeBehindTask;
+
+      //! Requests waiting for the write-behind task
+      Os::Queue m_writeQueue;
+
+      //! The number of requests that had to wait for room on the write queue
+      U32 m_writeQueueStalls;
+
+      //! Guards the statistics updated by the write-behind task
+      Os::Mutex m_statsLock;
+
+      //! The number of buffers logged
+      U32 m_numLoggedBuffers;
+
+      //! The longest time in microseconds from receiving a buffer to
+      //! writing it, since the last telemetry report
+      U32 m_maxWriteLatency;
+
   };
 
 }
@@ -32,7 +32,8 @@ namespace Svc {
       maxSize(0),
       sizeOfSize(0),
       mode(Mode::CLOSED),
-      bytesWritten(0)
+      bytesWritten(0),
+      hashValid(false)
   {
   }
 
@@ -79,7 +80,7 @@ namespace Svc {
       this->open();
   }
 
-  void BufferLogger::File ::
+  bool BufferLogger::File ::
     logBuffer(
         const U8 *const data,
         const U32 size
@@ -98,9 +99,11 @@ namespace Svc {
       this->open();
     }
     // Write to the file if it is open
+    bool status = false;
     if (this->mode == File::Mode::OPEN) {
-      (void) this->writeBuffer(data, size);
+      status = this->writeBuffer(data, size);
     }
+    return status;
   }
 
   void BufferLogger::File ::
@@ -156,6 +159,9 @@ namespace Svc {
       this->fileCounter++;
       // Reset bytes written
       this->bytesWritten = 0;
+      // Start the running hash
+      this->hash.init();
+      this->hashValid = true;
       // Set mode
       this->mode = File::Mode::OPEN;
     }
@@ -207,9 +213,13 @@ namespace Svc {
     bool status;
     if (fileStatus == Os::File::OP_OK && size == static_cast<NATIVE_INT_TYPE>(length)) {
       this->bytesWritten += length;
+      this->hash.update(data, size);
       status = true;
     }
     else {
+      // Part of the data may have reached the file, so the running hash
+      // no longer matches it
+      this->hashValid = false;
       Fw::LogStringArg string(this->name.toChar());
 
       this->bufferLogger.log_WARNING_HI_BL_LogFileWriteError(fileStatus, size, length, string);
@@ -222,8 +232,16 @@ namespace Svc {
     writeHashFile()
   {
     Os::ValidatedFile validatedFile(this->name.toChar());
-    const Os::ValidateFile::Status status =
-      validatedFile.createHashFile();
+    Os::ValidateFile::Status status;
+    if (this->hashValid) {
+      // Write the running hash instead of reading the file back
+      Utils::HashBuffer hashBuffer;
+      this->hash.final(hashBuffer);
+      status = validatedFile.createHashFile(hashBuffer);
+    }
+    else {
+      status = validatedFile.createHashFile();
+    }
     if (status !=  Os::ValidateFile::VALIDATION_OK) {
       const Fw::String &hashFileName = validatedFile.getHashFileName();
       Fw::LogStringArg logStringArg(hashFileName.toChar());
@@ -12,6 +12,8 @@
 
 #include "Logging.hpp"
 #include "Os/FileSystem.hpp"
+#include "Os/ValidatedFile.hpp"
+#include <cstring>
 
 namespace Svc {
 
@@ -273,6 +275,76 @@ namespace Svc {
       }
     }
 
+    class RunningHashTester :
+      public Logging::Tester
+    {
+
+      private:
+
+        //! Check that the hash file written at close is identical to one
+        //! created by reading the file back
+        void checkHashFile(const Fw::StringBase& fileName) {
+          Os::ValidatedFile validatedFile(fileName.toChar());
+          ASSERT_EQ(Os::ValidateFile::VALIDATION_OK, validatedFile.validate());
+          Fw::String referenceName;
+          referenceName.format("%s.ref", validatedFile.getHashFileName().toChar());
+          Utils::HashBuffer reference;
+          ASSERT_EQ(
+              Os::ValidateFile::VALIDATION_OK,
+              Os::ValidateFile::createValidation(
+                fileName.toChar(),
+                referenceName.toChar(),
+                reference
+              )
+          );
+          U8 written[2*HASH_DIGEST_LENGTH];
+          NATIVE_INT_TYPE size = sizeof(written);
+          Os::File file;
+          ASSERT_EQ(
+              Os::File::OP_OK,
+              file.open(validatedFile.getHashFileName().toChar(), Os::File::OPEN_READ)
+          );
+          ASSERT_EQ(Os::File::OP_OK, file.read(written, size));
+          file.close();
+          ASSERT_EQ(static_cast<NATIVE_INT_TYPE>(reference.getBuffLength()), size);
+          ASSERT_EQ(0, memcmp(written, reference.getBuffAddr(), size));
+          (void) Os::FileSystem::removeFile(referenceName.toChar());
+        }
+
+      public:
+
+        void test() {
+          // Hash computed while writing
+          this->component.m_file.baseName = Fw::String("RunningHashTester");
+          this->sendComBuffers(3);
+          this->sendManagedBuffers(2);
+          ASSERT_TRUE(this->component.m_file.hashValid);
+          Fw::String fileName = this->component.m_file.name;
+          this->sendCmd_BL_CloseFile(0, 0);
+          this->dispatchOne();
+          this->checkHashFile(fileName);
+
+          // After a failed write the hash comes from reading the file back
+          this->sendComBuffers(2);
+          fileName = this->component.m_file.name;
+          this->component.m_file.osFile.close();
+          this->sendComBuffers(1);
+          ASSERT_FALSE(this->component.m_file.hashValid);
+          this->sendCmd_BL_CloseFile(0, 0);
+          this->dispatchOne();
+          this->checkHashFile(fileName);
+          ASSERT_EVENTS_BL_LogFileValidationError_SIZE(0);
+        }
+
+    };
+
+    void Tester ::
+      RunningHash()
+    {
+      RunningHashTester tester;
+      tester.test();
+    }
+
   }
 
 }
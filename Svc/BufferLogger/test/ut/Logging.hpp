@@ -41,6 +41,9 @@ namespace Svc {
         //! Test logging on/off capability
         void OnOff();
 
+        //! Test that the hash written at close matches the file
+        void RunningHash();
+
     };
 
   }
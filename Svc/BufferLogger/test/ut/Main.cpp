@@ -6,6 +6,7 @@
 #include "Errors.hpp"
 #include "Logging.hpp"
 #include "Health.hpp"
+#include "WriteBehind.hpp"
 
 TEST(Test, LogNoInit) {
   Svc::Tester tester(false); // don't call initLog for the user
@@ -55,6 +56,30 @@ TEST(TestLogging, OnOff) {
   tester.OnOff();
 }
 
+TEST(TestLogging, RunningHash) {
+  Svc::Logging::Tester tester;
+  tester.RunningHash();
+}
+
+// ----------------------------------------------------------------------
+// Test WriteBehind
+// ----------------------------------------------------------------------
+
+TEST(TestWriteBehind, Logging) {
+  Svc::WriteBehind::Tester tester;
+  tester.Logging();
+}
+
+TEST(TestWriteBehind, Commands) {
+  Svc::WriteBehind::Tester tester;
+  tester.Commands();
+}
+
+TEST(TestWriteBehind, Telemetry) {
+  Svc::WriteBehind::Tester tester;
+  tester.Telemetry();
+}
+
 // ----------------------------------------------------------------------
 // Test Health
 // ----------------------------------------------------------------------
@@ -0,0 +1,174 @@
+// ======================================================================
+// \title  WriteBehind.cpp
+// \brief  Implementation for BufferLogger write-behind tests
+//
+// \copyright
+// Copyright (C) 2017 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "WriteBehind.hpp"
+
+namespace Svc {
+
+  namespace WriteBehind {
+
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      Logging()
+    {
+      this->component.m_file.baseName = Fw::String("WriteBehindLogging");
+      this->startTask();
+      // Fill one file with managed buffers and start a second with com buffers
+      this->sendManagedBuffers(MAX_ENTRIES_PER_FILE);
+      this->sendComBuffers(2);
+      this->sendCmd_BL_SetLogging(0, 0, BufferLogger_LogState::LOGGING_OFF);
+      this->dispatchOne();
+      this->stopTask();
+
+      // Every managed buffer came back after it was written
+      ASSERT_from_bufferSendOut_SIZE(MAX_ENTRIES_PER_FILE);
+      ASSERT_CMD_RESPONSE_SIZE(1);
+      ASSERT_CMD_RESPONSE(
+          0,
+          BufferLogger::OPCODE_BL_SETLOGGING,
+          0,
+          Fw::CmdResponse::OK
+      );
+      ASSERT_EVENTS_BL_LogFileClosed_SIZE(2);
+      ASSERT_EQ(BufferLogger::File::Mode::CLOSED, this->component.m_file.mode);
+
+      Fw::String fileName;
+      fileName.format("buf/logWriteBehindLogging.buf");
+      this->checkLogFileIntegrity(
+          fileName.toChar(),
+          MAX_BYTES_PER_FILE,
+          MAX_ENTRIES_PER_FILE
+      );
+      this->checkFileValidation(fileName.toChar());
+      fileName.format("buf/logWriteBehindLogging1.buf");
+      this->checkLogFileIntegrity(
+          fileName.toChar(),
+          2 * (COM_BUFFER_LENGTH + sizeof(SIZE_TYPE)),
+          2
+      );
+      this->checkFileValidation(fileName.toChar());
+
+      // With logging off buffers come straight back
+      this->clearHistory();
+      this->sendManagedBuffers(1);
+      ASSERT_from_bufferSendOut_SIZE(1);
+    }
+
+    void Tester ::
+      Commands()
+    {
+      this->startTask();
+      this->sendCmd_BL_OpenFile(0, 1, "WriteBehindCommands");
+      this->dispatchOne();
+      this->sendComBuffers(1);
+      this->sendCmd_BL_FlushFile(0, 2);
+      this->dispatchOne();
+      this->sendCmd_BL_CloseFile(0, 3);
+      this->dispatchOne();
+      this->stopTask();
+
+      // The task answers each command in order
+      ASSERT_CMD_RESPONSE_SIZE(3);
+      ASSERT_CMD_RESPONSE(
+          0,
+          BufferLogger::OPCODE_BL_OPENFILE,
+          1,
+          Fw::CmdResponse::OK
+      );
+      ASSERT_CMD_RESPONSE(
+          1,
+          BufferLogger::OPCODE_BL_FLUSHFILE,
+          2,
+          Fw::CmdResponse::OK
+      );
+      ASSERT_CMD_RESPONSE(
+          2,
+          BufferLogger::OPCODE_BL_CLOSEFILE,
+          3,
+          Fw::CmdResponse::OK
+      );
+      ASSERT_EVENTS_BL_LogFileClosed_SIZE(1);
+      ASSERT_EVENTS_BL_LogFileClosed(0, "buf/logWriteBehindCommands.buf");
+      this->checkLogFileIntegrity(
+          "buf/logWriteBehindCommands.buf",
+          COM_BUFFER_LENGTH + sizeof(SIZE_TYPE),
+          1
+      );
+      this->checkFileValidation("buf/logWriteBehindCommands.buf");
+    }
+
+    void Tester ::
+      Telemetry()
+    {
+      this->component.m_file.baseName = Fw::String("WriteBehindTelemetry");
+      this->startTask();
+      this->sendComBuffers(3);
+      // The write queue is reported only while the task runs
+      this->waitForLoggedBuffers(3);
+      this->invoke_to_schedIn(0, 0);
+      this->dispatchOne();
+      this->stopTask();
+
+      ASSERT_TLM_SIZE(5);
+      ASSERT_TLM_BufferLogger_NumLoggedBuffers(0, 3);
+      ASSERT_TLM_BufferLogger_WriteQueueDepth(0, 0);
+      ASSERT_TLM_BufferLogger_WriteQueueHighWater_SIZE(1);
+      ASSERT_GE(this->tlmHistory_BufferLogger_WriteQueueHighWater->at(0).arg, 1u);
+      ASSERT_TLM_BufferLogger_WriteQueueStalls_SIZE(1);
+      ASSERT_TLM_BufferLogger_MaxWriteLatency_SIZE(1);
+
+      // The latency is reported since the last report
+      ASSERT_EQ(0u, this->component.m_maxWriteLatency);
+    }
+
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    void Tester ::
+      startTask(const NATIVE_INT_TYPE queueDepth)
+    {
+      Fw::String name("BLWriteBehind");
+      this->component.startWriteBehindTask(name, queueDepth);
+      ASSERT_TRUE(this->component.m_writeBehind);
+    }
+
+    void Tester ::
+      stopTask()
+    {
+      this->component.stopWriteBehindTask();
+      const Os::Task::TaskStatus status =
+        this->component.joinWriteBehindTask(nullptr);
+      ASSERT_EQ(Os::Task::TASK_OK, status);
+      ASSERT_FALSE(this->component.m_writeBehind);
+    }
+
+    void Tester ::
+      waitForLoggedBuffers(const U32 count)
+    {
+      for (U32 tries = 0; tries < 1000; ++tries) {
+        this->component.m_statsLock.lock();
+        const U32 numLoggedBuffers = this->component.m_numLoggedBuffers;
+        this->component.m_statsLock.unLock();
+        if (numLoggedBuffers >= count) {
+          return;
+        }
+        Os::Task::delay(1);
+      }
+      FAIL() << "write-behind task did not log " << count << " buffers";
+    }
+
+  }
+
+}
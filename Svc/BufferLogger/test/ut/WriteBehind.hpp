@@ -0,0 +1,65 @@
+// ======================================================================
+// \title  WriteBehind.hpp
+// \brief  Interface for BufferLogger write-behind tests
+//
+// \copyright
+// Copyright (C) 2017 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_WriteBehind_HPP
+#define Svc_WriteBehind_HPP
+
+#include "Tester.hpp"
+
+namespace Svc {
+
+  namespace WriteBehind {
+
+    class Tester :
+      public Svc::Tester
+    {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Tests
+        // ----------------------------------------------------------------------
+
+        //! Test logging of data from bufferSendIn and comIn on the task
+        void Logging();
+
+        //! Test file commands on the task
+        void Commands();
+
+        //! Test write-behind telemetry
+        void Telemetry();
+
+      protected:
+
+        // ----------------------------------------------------------------------
+        // Helper methods
+        // ----------------------------------------------------------------------
+
+        //! Start the write-behind task
+        void startTask(
+            const NATIVE_INT_TYPE queueDepth = 4 //!< The write queue depth
+        );
+
+        //! Stop the write-behind task and wait for it to finish
+        void stopTask();
+
+        //! Wait for the write-behind task to log a number of buffers
+        void waitForLoggedBuffers(
+            const U32 count //!< The number of buffers logged
+        );
+
+    };
+
+  }
+
+}
+
+#endif
@@ -16,9 +16,12 @@
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Buffer/Buffer.hpp>
 #include <new>
+#include <cstring>
 
 namespace Svc {
 
+  const U32 BufferManagerComponentImpl::NO_BUFFER;
+
   // ----------------------------------------------------------------------
   // Construction, initialization, and destruction
   // ----------------------------------------------------------------------
@@ -31,6 +34,8 @@ namespace Svc {
     ,m_cleaned(false)
     ,m_mgrId(0)
     ,m_buffers(nullptr)
+    ,m_numFreeLists(0)
+    ,m_mode(LOCKED)
     ,m_allocator(nullptr)
     ,m_memId(0)
     ,m_numStructs(0)
@@ -39,7 +44,10 @@ namespace Svc {
     ,m_noBuffs(0)
     ,m_emptyBuffs(0)
   {
-
+    memset(this->m_freeLists,0,sizeof(this->m_freeLists));
+    for (NATIVE_UINT_TYPE list = 0; list < BUFFERMGR_MAX_NUM_BINS; list++) {
+        this->m_freeStacks[list].store(packTop(0,NO_BUFFER));
+    }
   }
 
   void BufferManagerComponentImpl ::
@@ -109,8 +117,8 @@ namespace Svc {
       FW_ASSERT(reinterpret_cast<U8*>(fwBuffer.getData()) < (this->m_buffers[id].memory + this->m_buffers[id].size),id,this->m_mgrId);
       // user can make smaller for their own purposes, but it shouldn't be bigger
       FW_ASSERT(fwBuffer.getSize() <= this->m_buffers[id].size,id,this->m_mgrId);
-      // clear the allocated flag
-      this->m_buffers[id].allocated = false;
+      // clear the allocated flag and return the buffer to its free list
+      this->giveFreeBuffer(&this->m_buffers[id]);
       this->m_currBuffs--;
   }
 
@@ -123,36 +131,139 @@ namespace Svc {
       // make sure component has been set up
       FW_ASSERT(this->m_setup);
       FW_ASSERT(m_buffers);
-      // find smallest buffer based on size.
-      for (NATIVE_UINT_TYPE buff = 0; buff < this->m_numStructs; buff++) {
-          if ((not this->m_buffers[buff].allocated) and (size <= this->m_buffers[buff].size)) {
-              this->m_buffers[buff].allocated = true;
-              this->m_currBuffs++;
-              if (this->m_currBuffs > this->m_highWater) {
-                  this->m_highWater = this->m_currBuffs;
+      // find the smallest bin that fits, then take a free buffer from it or the next larger bins
+      AllocatedBuffer* const entry = this->takeFreeBuffer(this->findFreeList(size));
+      if (entry == nullptr) {
+          // if no buffers found, return empty buffer
+          this->log_WARNING_HI_NoBuffsAvailable(size);
+          this->m_noBuffs++;
+          return Fw::Buffer();
+      }
+      // update the high water mark, which may race with other callers in LOCK_FREE mode
+      const U32 current = ++this->m_currBuffs;
+      U32 highWater = this->m_highWater.load();
+      while ((current > highWater) and (not this->m_highWater.compare_exchange_weak(highWater,current))) {
+      }
+      Fw::Buffer copy = entry->buff;
+      // change size to match request
+      copy.setSize(size);
+      return copy;
+  }
+
+  // ----------------------------------------------------------------------
+  // Free list helpers
+  // ----------------------------------------------------------------------
+
+  U64 BufferManagerComponentImpl ::
+    packTop(U32 tag, U32 index)
+  {
+      return (static_cast<U64>(tag) << 32) | static_cast<U64>(index);
+  }
+
+  BufferManagerComponentImpl::AllocatedBuffer* BufferManagerComponentImpl ::
+    takeFreeBuffer(NATIVE_UINT_TYPE first)
+  {
+      if (this->m_mode == LOCK_FREE) {
+          for (NATIVE_UINT_TYPE index = first; index < this->m_numFreeLists; index++) {
+              std::atomic<U64>& stack = this->m_freeStacks[index];
+              U64 top = stack.load(std::memory_order_acquire);
+              // pop the top buffer. The tag changes on every update, so a top that was popped and
+              // pushed back by another caller in the meantime fails the exchange.
+              while (static_cast<U32>(top) != NO_BUFFER) {
+                  AllocatedBuffer* const entry = &this->m_buffers[static_cast<U32>(top)];
+                  const U32 next = entry->nextFree.load(std::memory_order_relaxed);
+                  const U64 newTop = packTop(static_cast<U32>(top >> 32) + 1, next);
+                  if (stack.compare_exchange_weak(top,newTop,std::memory_order_acquire,std::memory_order_acquire)) {
+                      FW_ASSERT(not entry->allocated);
+                      entry->allocated = true;
+                      return entry;
+                  }
               }
-              Fw::Buffer copy = this->m_buffers[buff].buff;
-              // change size to match request
-              copy.setSize(size);
-              return copy;
           }
+          return nullptr;
       }
 
-      // if no buffers found, return empty buffer
-      this->log_WARNING_HI_NoBuffsAvailable(size);
-      this->m_noBuffs++;
-      return Fw::Buffer();
+      this->m_mutex.lock();
+      AllocatedBuffer* entry = nullptr;
+      for (NATIVE_UINT_TYPE index = first; index < this->m_numFreeLists; index++) {
+          FreeList& list = this->m_freeLists[index];
+          if (list.head != nullptr) {
+              entry = list.head;
+              FW_ASSERT(not entry->allocated);
+              list.head = entry->next;
+              if (list.head == nullptr) {
+                  list.tail = nullptr;
+              }
+              entry->next = nullptr;
+              entry->allocated = true;
+              break;
+          }
+      }
+      this->m_mutex.unLock();
+      return entry;
+  }
 
+  void BufferManagerComponentImpl ::
+    giveFreeBuffer(AllocatedBuffer* entry)
+  {
+      FW_ASSERT(entry != nullptr);
+      FW_ASSERT(entry->freeList < this->m_numFreeLists,entry->freeList,this->m_numFreeLists);
+      if (this->m_mode == LOCK_FREE) {
+          std::atomic<U64>& stack = this->m_freeStacks[entry->freeList];
+          const U32 id = static_cast<U32>(entry - this->m_buffers);
+          entry->allocated = false;
+          // push onto the top of the stack; the release ordering publishes the buffer state to the next taker
+          U64 top = stack.load(std::memory_order_relaxed);
+          U64 newTop = 0;
+          do {
+              entry->nextFree.store(static_cast<U32>(top),std::memory_order_relaxed);
+              newTop = packTop(static_cast<U32>(top >> 32) + 1, id);
+          } while (not stack.compare_exchange_weak(top,newTop,std::memory_order_release,std::memory_order_relaxed));
+          return;
+      }
+
+      this->m_mutex.lock();
+      // append to the tail of the free list
+      FreeList& list = this->m_freeLists[entry->freeList];
+      entry->allocated = false;
+      entry->next = nullptr;
+      if (list.tail != nullptr) {
+          list.tail->next = entry;
+      } else {
+          list.head = entry;
+      }
+      list.tail = entry;
+      this->m_mutex.unLock();
+  }
+
+  NATIVE_UINT_TYPE BufferManagerComponentImpl ::
+    findFreeList(U32 size) const
+  {
+      // binary search for the first free list with buffers at least as large as the request
+      NATIVE_UINT_TYPE low = 0;
+      NATIVE_UINT_TYPE high = this->m_numFreeLists;
+      while (low < high) {
+          const NATIVE_UINT_TYPE mid = low + (high - low) / 2;
+          if (this->m_freeLists[mid].bufferSize < size) {
+              low = mid + 1;
+          } else {
+              high = mid;
+          }
+      }
+      return low;
   }
 
   void BufferManagerComponentImpl::setup(
     NATIVE_UINT_TYPE mgrId, //!< manager ID
     NATIVE_UINT_TYPE memId, //!< Memory segment identifier
     Fw::MemAllocator& allocator, //!< memory allocator
-    const BufferBins& bins //!< Set of user bins
+    const BufferBins& bins, //!< Set of user bins
+    AllocationMode mode //!< How concurrent get and return calls are made safe
   ) {
 
     this->m_mgrId = mgrId;
+    this->m_mode = mode;
+    this->m_cleaned = false;
     this->m_memId = memId;
     this->m_allocator = &allocator;
     // clear bins
@@ -187,10 +298,37 @@ namespace Svc {
     // struct past the number of structs
     U8* bufferMem = reinterpret_cast<U8*>(&this->m_buffers[this->m_numStructs]);
 
+    // build one free list per used bin, sorted by increasing buffer size. Insertion keeps bins
+    // of equal size in table order.
+    NATIVE_UINT_TYPE binToList[BUFFERMGR_MAX_NUM_BINS];
+    memset(binToList,0,sizeof(binToList));
+    memset(this->m_freeLists,0,sizeof(this->m_freeLists));
+    this->m_numFreeLists = 0;
+    for (NATIVE_UINT_TYPE bin = 0; bin < BUFFERMGR_MAX_NUM_BINS; bin++) {
+        if (this->m_bufferBins.bins[bin].numBuffers) {
+            const U32 bufferSize = this->m_bufferBins.bins[bin].bufferSize;
+            NATIVE_UINT_TYPE index = this->m_numFreeLists;
+            while ((index > 0) and (this->m_freeLists[index - 1].bufferSize > bufferSize)) {
+                this->m_freeLists[index] = this->m_freeLists[index - 1];
+                index--;
+            }
+            this->m_freeLists[index].bufferSize = bufferSize;
+            this->m_numFreeLists++;
+            // shift the mapping of any bins moved up by the insertion
+            for (NATIVE_UINT_TYPE prev = 0; prev < bin; prev++) {
+                if (this->m_bufferBins.bins[prev].numBuffers and (binToList[prev] >= index)) {
+                    binToList[prev]++;
+                }
+            }
+            binToList[bin] = index;
+        }
+    }
+
     // walk through entries and initialize them
     NATIVE_UINT_TYPE currStruct = 0;
     for (NATIVE_UINT_TYPE bin = 0; bin < BUFFERMGR_MAX_NUM_BINS; bin++) {
         if (this->m_bufferBins.bins[bin].numBuffers) {
+            FreeList& list = this->m_freeLists[binToList[bin]];
             for (NATIVE_UINT_TYPE binEntry = 0; binEntry < this->m_bufferBins.bins[bin].numBuffers; binEntry++) {
                 // placement new for Fw::Buffer instance. We don't need the new() return value,
                 // because we know where the Fw::Buffer instance is
@@ -199,6 +337,16 @@ namespace Svc {
                 this->m_buffers[currStruct].allocated = false;
                 this->m_buffers[currStruct].memory = bufferMem;
                 this->m_buffers[currStruct].size = this->m_bufferBins.bins[bin].bufferSize;
+                this->m_buffers[currStruct].freeList = binToList[bin];
+                this->m_buffers[currStruct].next = nullptr;
+                (void) new(&this->m_buffers[currStruct].nextFree) std::atomic<U32>(NO_BUFFER);
+                // append to the bin's free list so buffers are first handed out in memory order
+                if (list.tail != nullptr) {
+                    list.tail->next = &this->m_buffers[currStruct];
+                } else {
+                    list.head = &this->m_buffers[currStruct];
+                }
+                list.tail = &this->m_buffers[currStruct];
                 bufferMem += this->m_bufferBins.bins[bin].bufferSize;
                 currStruct++;
             }
@@ -212,6 +360,17 @@ namespace Svc {
         reinterpret_cast<POINTER_CAST>(CURR_PTR), reinterpret_cast<POINTER_CAST>(END_PTR));
     // secondary init verification
     FW_ASSERT(currStruct == this->m_numStructs,currStruct,this->m_numStructs);
+
+    // build the free stacks, pushing in reverse so buffers are first handed out in memory order
+    for (NATIVE_UINT_TYPE list = 0; list < BUFFERMGR_MAX_NUM_BINS; list++) {
+        this->m_freeStacks[list].store(packTop(0,NO_BUFFER));
+    }
+    for (NATIVE_UINT_TYPE entry = this->m_numStructs; entry > 0; entry--) {
+        AllocatedBuffer& buffer = this->m_buffers[entry - 1];
+        std::atomic<U64>& stack = this->m_freeStacks[buffer.freeList];
+        buffer.nextFree.store(static_cast<U32>(stack.load()));
+        stack.store(packTop(0,entry - 1));
+    }
     // indicate setup is done
     this->m_setup = true;
   }
@@ -15,7 +15,9 @@
 
 #include "Svc/BufferManager/BufferManagerComponentAc.hpp"
 #include <Fw/Types/MemAllocator.hpp>
+#include <Os/Mutex.hpp>
 #include "BufferManagerComponentImplCfg.hpp"
+#include <atomic>
 
 namespace Svc
 {
@@ -28,10 +30,12 @@ namespace Svc
     // The rules for specifying bins:
     // 1. For each bin (BufferBins.bins[n]), specify the size of the buffers (bufferSize) in the
     //    bin and how many buffers for that bin (numBuffers).
-    // 2. The bins should be ordered based on an increasing bufferSize to allow BufferManager to
-    //    search for available buffers. When receiving a request for a buffer, the component will
-    //    search for the first buffer from the bins that is equal to or greater
-    //    than the requested size, starting at the beginning of the table.
+    // 2. The bins should be ordered based on an increasing bufferSize. When receiving a request
+    //    for a buffer, the component will return a free buffer from the bin with the smallest
+    //    bufferSize that is equal to or greater than the requested size. If that bin has no free
+    //    buffers, the next larger bin is used. Each bin keeps its free buffers in a list, so
+    //    getting and returning a buffer take constant time regardless of the number of buffers.
+    //    Bins given out of order are sorted by bufferSize during setup().
     // 3. Any unused bins should have numBuffers set to 0.
     // 4. A single bin can be specified if a single size is needed.
     //
@@ -48,6 +52,15 @@ namespace Svc
     // 4. A returned buffer has an indicated size larger than originally allocated.
     // 5. A returned buffer has a pointer different than the one originally allocated.
     //
+    // Two allocation modes are available, chosen when calling setup():
+    // 1. LOCKED (default): getting and returning buffers is serialized on a mutex, and free
+    //    buffers of a bin are reused in the order they were returned.
+    // 2. LOCK_FREE: each bin's free buffers form a stack updated with compare-and-swap, so
+    //    callers on many threads never block each other. Free buffers are reused most recently
+    //    returned first. The stack top carries a 32-bit modification tag alongside the buffer
+    //    index to protect against ABA. This mode requires lock-free 64-bit atomics for best
+    //    performance.
+    //
     // Note that a pointer to the Fw::MemAllocator used in setup() is stored for later memory cleanup.
     // The instance of the allocator must persist beyond calling the cleanup() function or the
     // destructor of BufferManager if cleanup() is not called. If a project-specific manual memory
@@ -87,6 +100,13 @@ namespace Svc
             BufferBin bins[BUFFERMGR_MAX_NUM_BINS]; //!< set of bins to define buffers
         };
 
+        // How concurrent get and return calls are made safe
+        enum AllocationMode
+        {
+            LOCKED,   //!< serialize get and return on a mutex
+            LOCK_FREE //!< use compare-and-swap on per-bin free stacks
+        };
+
         //! set up configuration
 
         void setup(
@@ -94,7 +114,8 @@ namespace Svc
             NATIVE_UINT_TYPE memID,      //!< Memory segment identifier
             Fw::MemAllocator &allocator, //!< memory allocator. MUST be persistent for later deallocation.
                                          //!  MUST persist past destructor if cleanup() not called explicitly.
-            const BufferBins &bins       //!< Set of user bins
+            const BufferBins &bins,      //!< Set of user bins
+            AllocationMode mode = LOCKED //!< How concurrent get and return calls are made safe
         );
 
         void cleanup();              // Free memory prior to end of program if desired. Otherwise,
@@ -143,18 +164,61 @@ namespace Svc
             U8 *memory;      //!< pointer to memory buffer
             U32 size;        //!< size of the buffer
             bool allocated;  //!< this buffer has been allocated
+            NATIVE_UINT_TYPE freeList; //!< index of the free list in m_freeLists this buffer belongs to
+            AllocatedBuffer *next; //!< next buffer in the free list when not allocated (LOCKED mode)
+            std::atomic<U32> nextFree; //!< index of next buffer in the free stack when not allocated (LOCK_FREE mode)
         };
 
+        // Free buffers of a single size in LOCKED mode. Buffers are taken from the head and
+        // returned to the tail, so buffers are reused in the order they were returned.
+        struct FreeList
+        {
+            U32 bufferSize;        //!< size of the buffers in this list
+            AllocatedBuffer *head; //!< next buffer to allocate, nullptr if none are free
+            AllocatedBuffer *tail; //!< most recently returned buffer
+        };
+
+        //! Find the index of the first free list whose buffers can hold the given size
+        //! \return the index, or m_numFreeLists if no buffers are large enough
+        NATIVE_UINT_TYPE findFreeList(
+            U32 size //!< requested buffer size
+        ) const;
+
+        //! Take a free buffer from the given free list or the next larger ones and mark it allocated
+        //! \return the buffer, or nullptr if none are free
+        AllocatedBuffer* takeFreeBuffer(
+            NATIVE_UINT_TYPE first //!< index of the first free list to search
+        );
+
+        //! Mark a buffer unallocated and give it back to its free list
+        void giveFreeBuffer(
+            AllocatedBuffer* entry //!< the buffer
+        );
+
+        //! Index marking the end of a free stack
+        static const U32 NO_BUFFER = 0xFFFFFFFF;
+
+        //! Pack a free stack modification tag and buffer index into a stack top
+        static U64 packTop(
+            U32 tag, //!< the modification tag
+            U32 index //!< the buffer index
+        );
+
         AllocatedBuffer *m_buffers;    //!< pointer to allocated buffer space
+        FreeList m_freeLists[BUFFERMGR_MAX_NUM_BINS]; //!< free lists, sorted by increasing buffer size
+        NATIVE_UINT_TYPE m_numFreeLists; //!< number of free lists in use
+        std::atomic<U64> m_freeStacks[BUFFERMGR_MAX_NUM_BINS]; //!< tagged tops of the free stacks (LOCK_FREE mode)
+        AllocationMode m_mode; //!< allocation mode chosen at setup
+        Os::Mutex m_mutex; //!< protects the free lists in LOCKED mode
         Fw::MemAllocator *m_allocator; //!< allocator for memory
         NATIVE_UINT_TYPE m_memId; //!< identifier for allocator
         NATIVE_UINT_TYPE m_numStructs; //!< number of allocated structs
 
         // stats
-        U32 m_highWater; //!< high watermark for allocations
-        U32 m_currBuffs; //!< number of currently allocated buffers
-        U32 m_noBuffs; //!< number of failures to allocate a buffer
-        U32 m_emptyBuffs; //!< number of empty buffers returned
+        std::atomic<U32> m_highWater; //!< high watermark for allocations
+        std::atomic<U32> m_currBuffs; //!< number of currently allocated buffers
+        std::atomic<U32> m_noBuffs; //!< number of failures to allocate a buffer
+        std::atomic<U32> m_emptyBuffs; //!< number of empty buffers returned
     };
 
 } // end namespace Svc
@@ -19,6 +19,16 @@ TEST(Nominal, MultSize) {
     tester.multBuffSize();
 }
 
+TEST(Nominal, MixedSizeChurn) {
+    Svc::Tester tester;
+    tester.mixedSizeChurn();
+}
+
+TEST(Nominal, ConcurrentGetReturn) {
+    Svc::Tester tester;
+    tester.concurrentGetReturn();
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
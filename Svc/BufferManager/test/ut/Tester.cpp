@@ -14,6 +14,7 @@
 #include <Fw/Types/MallocAllocator.hpp>
 #include <Fw/Test/UnitTest.hpp>
 #include <cstdlib>
+#include <pthread.h>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 100
@@ -27,6 +28,26 @@ static const NATIVE_UINT_TYPE BIN1_NUM_BUFFERS = 4;
 static const NATIVE_UINT_TYPE BIN2_BUFFER_SIZE = 100;
 static const NATIVE_UINT_TYPE BIN2_NUM_BUFFERS = 3;
 
+// Churn test bin sizes/numbers, deliberately not in increasing size order
+static const NATIVE_UINT_TYPE CHURN_NUM_BINS = 3;
+static const NATIVE_UINT_TYPE CHURN_BUFFER_SIZES[CHURN_NUM_BINS] = {64, 16, 256};
+static const NATIVE_UINT_TYPE CHURN_NUM_BUFFERS[CHURN_NUM_BINS] = {1000, 2000, 100};
+static const NATIVE_UINT_TYPE CHURN_ITERATIONS = 20000;
+
+// Contention test settings
+static const NATIVE_UINT_TYPE CONTENTION_MAX_THREADS = 8;
+static const NATIVE_UINT_TYPE CONTENTION_HELD = 4;
+static const NATIVE_UINT_TYPE CONTENTION_BUFFER_SIZE = 32;
+static const NATIVE_UINT_TYPE CONTENTION_OPERATIONS = 80000;
+
+// Arguments for a contention test thread
+struct ContentionArgs {
+    Svc::Tester* tester;
+    U8 pattern;
+    NATIVE_UINT_TYPE iterations;
+    bool ok;
+};
+
 // Other constants
 static const NATIVE_UINT_TYPE MEM_ID = 49;
 static const NATIVE_UINT_TYPE MGR_ID = 32;
@@ -499,6 +520,166 @@ namespace Svc {
 
 
 
+  void Tester::mixedSizeChurn() {
+
+      BufferManagerComponentImpl::BufferBins bins;
+      memset(&bins,0,sizeof(bins));
+      NATIVE_UINT_TYPE totalBuffers = 0;
+      for (NATIVE_UINT_TYPE bin = 0; bin < CHURN_NUM_BINS; bin++) {
+          bins.bins[bin].bufferSize = CHURN_BUFFER_SIZES[bin];
+          bins.bins[bin].numBuffers = CHURN_NUM_BUFFERS[bin];
+          totalBuffers += CHURN_NUM_BUFFERS[bin];
+      }
+
+      TestAllocator alloc;
+
+      this->component.setup(MGR_ID,MEM_ID,alloc,bins);
+
+      // free lists should be sorted by size regardless of table order
+      ASSERT_EQ(CHURN_NUM_BINS,this->component.m_numFreeLists);
+      for (NATIVE_UINT_TYPE list = 1; list < this->component.m_numFreeLists; list++) {
+          ASSERT_LT(this->component.m_freeLists[list-1].bufferSize,this->component.m_freeLists[list].bufferSize);
+      }
+
+      // shadow count of free buffers per bin
+      NATIVE_UINT_TYPE freeCount[CHURN_NUM_BINS];
+      for (NATIVE_UINT_TYPE bin = 0; bin < CHURN_NUM_BINS; bin++) {
+          freeCount[bin] = CHURN_NUM_BUFFERS[bin];
+      }
+
+      Fw::Buffer* held = new Fw::Buffer[totalBuffers];
+      NATIVE_UINT_TYPE numHeld = 0;
+
+      srand(0);
+      for (NATIVE_UINT_TYPE iter = 0; iter < CHURN_ITERATIONS; iter++) {
+          // favor getting until about half the pool is held, then favor returning
+          const bool get = (numHeld == 0) or ((numHeld < totalBuffers) and
+              (static_cast<NATIVE_UINT_TYPE>(rand()) % totalBuffers) >= numHeld);
+          if (get) {
+              const U32 size = 1 + static_cast<U32>(rand()) % CHURN_BUFFER_SIZES[2];
+              // expected bin is the smallest one that fits and has a free buffer
+              NATIVE_INT_TYPE expected = -1;
+              for (NATIVE_UINT_TYPE bin = 0; bin < CHURN_NUM_BINS; bin++) {
+                  if ((CHURN_BUFFER_SIZES[bin] >= size) and (freeCount[bin] > 0) and
+                      ((expected == -1) or (CHURN_BUFFER_SIZES[bin] < CHURN_BUFFER_SIZES[expected]))) {
+                      expected = static_cast<NATIVE_INT_TYPE>(bin);
+                  }
+              }
+              Fw::Buffer buff = this->invoke_to_bufferGetCallee(0,size);
+              if (expected == -1) {
+                  ASSERT_EQ(0,buff.getSize());
+                  this->clearEvents();
+                  continue;
+              }
+              ASSERT_EQ(size,buff.getSize());
+              const U32 id = buff.getContext() & 0xFFFF;
+              ASSERT_TRUE(this->component.m_buffers[id].allocated);
+              ASSERT_EQ(CHURN_BUFFER_SIZES[expected],this->component.m_buffers[id].size);
+              freeCount[expected]--;
+              held[numHeld++] = buff;
+          } else {
+              const NATIVE_UINT_TYPE index = static_cast<NATIVE_UINT_TYPE>(rand()) % numHeld;
+              const U32 id = held[index].getContext() & 0xFFFF;
+              const U32 size = this->component.m_buffers[id].size;
+              this->invoke_to_bufferSendIn(0,held[index]);
+              ASSERT_FALSE(this->component.m_buffers[id].allocated);
+              for (NATIVE_UINT_TYPE bin = 0; bin < CHURN_NUM_BINS; bin++) {
+                  if (CHURN_BUFFER_SIZES[bin] == size) {
+                      freeCount[bin]++;
+                  }
+              }
+              held[index] = held[--numHeld];
+          }
+          ASSERT_EQ(numHeld,this->component.m_currBuffs);
+      }
+
+      // return everything still held
+      for (NATIVE_UINT_TYPE index = 0; index < numHeld; index++) {
+          this->invoke_to_bufferSendIn(0,held[index]);
+      }
+      ASSERT_EQ(0,this->component.m_currBuffs);
+      delete[] held;
+
+      // cleanup BufferManager memory
+      this->component.cleanup();
+  }
+
+  void* Tester::contentionTask(void* arg) {
+      ContentionArgs* args = static_cast<ContentionArgs*>(arg);
+      Fw::Buffer held[CONTENTION_HELD];
+      for (NATIVE_UINT_TYPE iter = 0; iter < args->iterations; iter++) {
+          for (NATIVE_UINT_TYPE b = 0; b < CONTENTION_HELD; b++) {
+              held[b] = args->tester->invoke_to_bufferGetCallee(0,CONTENTION_BUFFER_SIZE);
+              if (held[b].getSize() != CONTENTION_BUFFER_SIZE) {
+                  args->ok = false;
+                  return nullptr;
+              }
+              // mark the buffer so a buffer handed to two threads at once is detected
+              memset(held[b].getData(),args->pattern,CONTENTION_BUFFER_SIZE);
+          }
+          for (NATIVE_UINT_TYPE b = 0; b < CONTENTION_HELD; b++) {
+              for (NATIVE_UINT_TYPE byte = 0; byte < CONTENTION_BUFFER_SIZE; byte++) {
+                  if (held[b].getData()[byte] != args->pattern) {
+                      args->ok = false;
+                  }
+              }
+              args->tester->invoke_to_bufferSendIn(0,held[b]);
+          }
+      }
+      return nullptr;
+  }
+
+  void Tester::concurrentGetReturn() {
+
+      const BufferManagerComponentImpl::AllocationMode modes[] = {
+          BufferManagerComponentImpl::LOCKED,
+          BufferManagerComponentImpl::LOCK_FREE
+      };
+
+      for (NATIVE_UINT_TYPE mode = 0; mode < FW_NUM_ARRAY_ELEMENTS(modes); mode++) {
+          for (NATIVE_UINT_TYPE numThreads = 1; numThreads <= CONTENTION_MAX_THREADS; numThreads *= 2) {
+
+              BufferManagerComponentImpl::BufferBins bins;
+              memset(&bins,0,sizeof(bins));
+              bins.bins[0].bufferSize = CONTENTION_BUFFER_SIZE;
+              bins.bins[0].numBuffers = CONTENTION_MAX_THREADS * CONTENTION_HELD;
+
+              TestAllocator alloc;
+
+              this->component.setup(MGR_ID,MEM_ID,alloc,bins,modes[mode]);
+              this->component.m_highWater = 0;
+              this->component.m_currBuffs = 0;
+
+              ContentionArgs args[CONTENTION_MAX_THREADS];
+              pthread_t threads[CONTENTION_MAX_THREADS];
+              const NATIVE_UINT_TYPE iterations = CONTENTION_OPERATIONS / (2 * CONTENTION_HELD * numThreads);
+
+              for (NATIVE_UINT_TYPE thread = 0; thread < numThreads; thread++) {
+                  args[thread].tester = this;
+                  args[thread].pattern = static_cast<U8>(thread + 1);
+                  args[thread].iterations = iterations;
+                  args[thread].ok = true;
+                  ASSERT_EQ(0,pthread_create(&threads[thread],nullptr,contentionTask,&args[thread]));
+              }
+              for (NATIVE_UINT_TYPE thread = 0; thread < numThreads; thread++) {
+                  ASSERT_EQ(0,pthread_join(threads[thread],nullptr));
+                  ASSERT_TRUE(args[thread].ok);
+              }
+
+              // everything should be back in the pool
+              ASSERT_EQ(0,this->component.m_currBuffs);
+              ASSERT_LE(this->component.m_highWater,numThreads * CONTENTION_HELD);
+              ASSERT_EQ(0,this->component.m_noBuffs);
+              for (NATIVE_UINT_TYPE b = 0; b < this->component.m_numStructs; b++) {
+                  ASSERT_FALSE(this->component.m_buffers[b].allocated);
+              }
+
+              // cleanup BufferManager memory
+              this->component.cleanup();
+          }
+      }
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods
   // ----------------------------------------------------------------------
@@ -52,12 +52,21 @@ namespace Svc {
       //! Multiple buffer sizes
       void multBuffSize();
 
+      //! Random get/return of mixed sizes from large, unsorted bins
+      void mixedSizeChurn();
+
+      //! Concurrent get/return from 1 to N threads in each allocation mode, checking no buffer is handed out twice
+      void concurrentGetReturn();
+
     private:
 
       // ----------------------------------------------------------------------
       // Helper methods
       // ----------------------------------------------------------------------
 
+      //! Thread entry point for concurrentGetReturn
+      static void* contentionTask(void* arg);
+
       //! Connect ports
       //!
       void connectPorts();
@@ -11,14 +11,34 @@
 #include <cstdio>
 
 namespace Svc {
+
+    static_assert(CMD_DISPATCHER_DISPATCH_INDEX_SIZE > CMD_DISPATCHER_DISPATCH_TABLE_SIZE,
+        "CMD_DISPATCHER_DISPATCH_INDEX_SIZE must be larger than CMD_DISPATCHER_DISPATCH_TABLE_SIZE");
+    static_assert(CMD_DISPATCHER_SEQUENCER_INDEX_SIZE > CMD_DISPATCHER_SEQUENCER_TABLE_SIZE,
+        "CMD_DISPATCHER_SEQUENCER_INDEX_SIZE must be larger than CMD_DISPATCHER_SEQUENCER_TABLE_SIZE");
+
+    static const NATIVE_INT_TYPE EMPTY_INDEX = -1;
+
+    // Multiplicative (Fibonacci) hash so clustered opcodes and consecutive
+    // sequence numbers spread across the index
+    static NATIVE_UINT_TYPE hashKey(U32 key, NATIVE_UINT_TYPE size) {
+        return static_cast<U32>(key * 2654435761U) % size;
+    }
+
     CommandDispatcherImpl::CommandDispatcherImpl(const char* name) :
         CommandDispatcherComponentBase(name),
+        m_numEntries(0),
+        m_numFreePending(0),
         m_seq(0),
         m_numCmdsDispatched(0),
         m_numCmdErrors(0)
     {
         memset(this->m_entryTable,0,sizeof(this->m_entryTable));
         memset(this->m_sequenceTracker,0,sizeof(this->m_sequenceTracker));
+        for (NATIVE_UINT_TYPE index = 0; index < FW_NUM_ARRAY_ELEMENTS(this->m_entryIndex); index++) {
+            this->m_entryIndex[index] = EMPTY_INDEX;
+        }
+        this->clearPending();
     }
 
     CommandDispatcherImpl::~CommandDispatcherImpl() {
@@ -31,27 +51,83 @@ namespace Svc {
         CommandDispatcherComponentBase::init(queueDepth);
     }
 
-    void CommandDispatcherImpl::compCmdReg_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode) {
-        // search for an empty slot
-        bool slotFound = false;
-        for (U32 slot = 0; slot < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); slot++) {
-            if ((not this->m_entryTable[slot].used) and (not slotFound)) {
-                this->m_entryTable[slot].opcode = opCode;
-                this->m_entryTable[slot].port = portNum;
-                this->m_entryTable[slot].used = true;
-                this->log_DIAGNOSTIC_OpCodeRegistered(opCode,portNum,slot);
-                slotFound = true;
-            } else if ((this->m_entryTable[slot].used) &&
-                (this->m_entryTable[slot].opcode == opCode) &&
-                (this->m_entryTable[slot].port == portNum) &&
-                (not slotFound)) {
-                    slotFound = true;
-                    this->log_DIAGNOSTIC_OpCodeReregistered(opCode,portNum);
-            } else if (this->m_entryTable[slot].used) { // make sure no duplicates
-                FW_ASSERT(this->m_entryTable[slot].opcode != opCode, opCode);
+    NATIVE_UINT_TYPE CommandDispatcherImpl::findEntryIndex(FwOpcodeType opCode) const {
+        NATIVE_UINT_TYPE position = hashKey(opCode,CMD_DISPATCHER_DISPATCH_INDEX_SIZE);
+        // index is larger than the table, so there is always an empty position to stop on
+        while ((this->m_entryIndex[position] != EMPTY_INDEX) and
+               (this->m_entryTable[this->m_entryIndex[position]].opcode != opCode)) {
+            position = (position + 1) % CMD_DISPATCHER_DISPATCH_INDEX_SIZE;
+        }
+        return position;
+    }
+
+    NATIVE_UINT_TYPE CommandDispatcherImpl::findPendingIndex(U32 seq) const {
+        NATIVE_UINT_TYPE position = hashKey(seq,CMD_DISPATCHER_SEQUENCER_INDEX_SIZE);
+        while ((this->m_pendingIndex[position] != EMPTY_INDEX) and
+               (this->m_sequenceTracker[this->m_pendingIndex[position]].seq != seq)) {
+            position = (position + 1) % CMD_DISPATCHER_SEQUENCER_INDEX_SIZE;
+        }
+        return position;
+    }
+
+    void CommandDispatcherImpl::removePendingIndex(NATIVE_UINT_TYPE position) {
+        FW_ASSERT(position < CMD_DISPATCHER_SEQUENCER_INDEX_SIZE,position);
+        const NATIVE_INT_TYPE slot = this->m_pendingIndex[position];
+        FW_ASSERT(slot != EMPTY_INDEX,position);
+        this->m_sequenceTracker[slot].used = false;
+        FW_ASSERT(this->m_numFreePending < CMD_DISPATCHER_SEQUENCER_TABLE_SIZE,this->m_numFreePending);
+        this->m_freePending[this->m_numFreePending++] = slot;
+
+        // shift back any following entries whose probe chain passes through the hole
+        NATIVE_UINT_TYPE hole = position;
+        NATIVE_UINT_TYPE next = position;
+        while (true) {
+            next = (next + 1) % CMD_DISPATCHER_SEQUENCER_INDEX_SIZE;
+            if (this->m_pendingIndex[next] == EMPTY_INDEX) {
+                break;
+            }
+            const NATIVE_UINT_TYPE home = hashKey(this->m_sequenceTracker[this->m_pendingIndex[next]].seq,CMD_DISPATCHER_SEQUENCER_INDEX_SIZE);
+            // entry may move if its home is not cyclically within (hole, next]
+            const bool stays = (hole <= next) ?
+                ((hole < home) and (home <= next)) :
+                ((hole < home) or (home <= next));
+            if (not stays) {
+                this->m_pendingIndex[hole] = this->m_pendingIndex[next];
+                hole = next;
             }
         }
-        FW_ASSERT(slotFound,opCode);
+        this->m_pendingIndex[hole] = EMPTY_INDEX;
+    }
+
+    void CommandDispatcherImpl::clearPending() {
+        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); entry++) {
+            this->m_sequenceTracker[entry].used = false;
+            // stack is popped from the end, so lowest slots are handed out first
+            this->m_freePending[entry] = CMD_DISPATCHER_SEQUENCER_TABLE_SIZE - 1 - entry;
+        }
+        this->m_numFreePending = CMD_DISPATCHER_SEQUENCER_TABLE_SIZE;
+        for (NATIVE_UINT_TYPE index = 0; index < FW_NUM_ARRAY_ELEMENTS(this->m_pendingIndex); index++) {
+            this->m_pendingIndex[index] = EMPTY_INDEX;
+        }
+    }
+
+    void CommandDispatcherImpl::compCmdReg_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode) {
+        const NATIVE_UINT_TYPE position = this->findEntryIndex(opCode);
+        if (this->m_entryIndex[position] != EMPTY_INDEX) {
+            // opcode may only be registered again by the same port
+            FW_ASSERT(this->m_entryTable[this->m_entryIndex[position]].port == portNum, opCode);
+            this->log_DIAGNOSTIC_OpCodeReregistered(opCode,portNum);
+            return;
+        }
+        // entries are never removed, so the next empty slot is at the end
+        const U32 slot = this->m_numEntries;
+        FW_ASSERT(slot < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable),opCode);
+        this->m_entryTable[slot].opcode = opCode;
+        this->m_entryTable[slot].port = portNum;
+        this->m_entryTable[slot].used = true;
+        this->m_entryIndex[position] = slot;
+        this->m_numEntries++;
+        this->log_DIAGNOSTIC_OpCodeRegistered(opCode,portNum,slot);
     }
 
     void CommandDispatcherImpl::compCmdStat_handler(NATIVE_INT_TYPE portNum, FwOpcodeType opCode, U32 cmdSeq, const Fw::CmdResponse &response) {
@@ -67,18 +143,14 @@ namespace Svc {
         // look for command source
         NATIVE_INT_TYPE portToCall = -1;
         U32 context;
-        for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
-            if (
-                    (this->m_sequenceTracker[pending].seq == cmdSeq) &&
-                    (this->m_sequenceTracker[pending].used)
-                ) {
-                portToCall = this->m_sequenceTracker[pending].callerPort;
-                context = this->m_sequenceTracker[pending].context;
-                FW_ASSERT(opCode == this->m_sequenceTracker[pending].opCode);
-                FW_ASSERT(portToCall < this->getNum_seqCmdStatus_OutputPorts());
-                this->m_sequenceTracker[pending].used = false;
-                break;
-            }
+        const NATIVE_UINT_TYPE position = this->findPendingIndex(cmdSeq);
+        if (this->m_pendingIndex[position] != EMPTY_INDEX) {
+            const NATIVE_INT_TYPE pending = this->m_pendingIndex[position];
+            portToCall = this->m_sequenceTracker[pending].callerPort;
+            context = this->m_sequenceTracker[pending].context;
+            FW_ASSERT(opCode == this->m_sequenceTracker[pending].opCode);
+            FW_ASSERT(portToCall < this->getNum_seqCmdStatus_OutputPorts());
+            this->removePendingIndex(position);
         }
 
         if (portToCall != -1) {
@@ -103,31 +175,29 @@ namespace Svc {
             return;
         }
 
-        // search for opcode in dispatch table
-        U32 entry;
-        bool entryFound = false;
-
-        for (entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_entryTable); entry++) {
-            if ((this->m_entryTable[entry].used) and (cmdPkt.getOpCode() == this->m_entryTable[entry].opcode)) {
-                entryFound = true;
-                break;
-            }
-        }
+        // look up opcode in dispatch index
+        const NATIVE_INT_TYPE entry = this->m_entryIndex[this->findEntryIndex(cmdPkt.getOpCode())];
+        const bool entryFound = (entry != EMPTY_INDEX);
         if (entryFound and this->isConnected_compCmdSend_OutputPort(this->m_entryTable[entry].port)) {
             // register command in command tracker only if response port is connect
             if (this->isConnected_seqCmdStatus_OutputPort(portNum)) {
                 bool pendingFound = false;
 
-                for (U32 pending = 0; pending < FW_NUM_ARRAY_ELEMENTS(this->m_sequenceTracker); pending++) {
-                    if (not this->m_sequenceTracker[pending].used) {
-                        pendingFound = true;
-                        this->m_sequenceTracker[pending].used = true;
-                        this->m_sequenceTracker[pending].opCode = cmdPkt.getOpCode();
-                        this->m_sequenceTracker[pending].seq = this->m_seq;
-                        this->m_sequenceTracker[pending].context = context;
-                        this->m_sequenceTracker[pending].callerPort = portNum;
-                        break;
-                    }
+                NATIVE_UINT_TYPE position = this->findPendingIndex(this->m_seq);
+                if (this->m_pendingIndex[position] != EMPTY_INDEX) {
+                    // stale entry left from before the sequence number wrapped
+                    this->removePendingIndex(position);
+                    position = this->findPendingIndex(this->m_seq);
+                }
+                if (this->m_numFreePending > 0) {
+                    pendingFound = true;
+                    const NATIVE_INT_TYPE pending = this->m_freePending[--this->m_numFreePending];
+                    this->m_sequenceTracker[pending].used = true;
+                    this->m_sequenceTracker[pending].opCode = cmdPkt.getOpCode();
+                    this->m_sequenceTracker[pending].seq = this->m_seq;
+                    this->m_sequenceTracker[pending].context = context;
+                    this->m_sequenceTracker[pending].callerPort = portNum;
+                    this->m_pendingIndex[position] = pending;
                 }
 
                 // if we couldn't find a slot to track the command, quit
@@ -183,9 +253,7 @@ namespace Svc {
 
     void CommandDispatcherImpl::CMD_CLEAR_TRACKING_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
         // clear tracking table
-        for (NATIVE_INT_TYPE entry = 0; entry < CMD_DISPATCHER_SEQUENCER_TABLE_SIZE; entry++) {
-            this->m_sequenceTracker[entry].used = false;
-        }
+        this->clearPending();
         this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
     }
 
@@ -138,7 +138,7 @@ namespace Svc {
             //! in the table by checking for the "used" flag. The opcode
             //! member is set to the opcode, and the port member set to the
             //! port to dispatch to. When a new opcode is received for
-            //! execution, the table is traversed until the opcode is located.
+            //! execution, the entry is located through m_entryIndex.
 
             struct DispatchEntry {
                     bool used; //!< if entry has been used yet
@@ -146,6 +146,17 @@ namespace Svc {
                     NATIVE_INT_TYPE port; //!< which port the entry invokes
             } m_entryTable[CMD_DISPATCHER_DISPATCH_TABLE_SIZE]; //!< table of dispatch entries
 
+            //! Open-addressed hash index of opcode to m_entryTable slot. Entries are
+            //! never removed, so linear probing stops at the first empty index slot.
+            NATIVE_INT_TYPE m_entryIndex[CMD_DISPATCHER_DISPATCH_INDEX_SIZE];
+            NATIVE_UINT_TYPE m_numEntries; //!< number of used entries in m_entryTable
+
+            //!  \brief Find the opcode in the dispatch index
+            //!
+            //!  \param opCode the opcode to look up
+            //!  \return the position in m_entryIndex holding the opcode, or the empty position where it would be added
+            NATIVE_UINT_TYPE findEntryIndex(FwOpcodeType opCode) const;
+
             //! \struct SequenceTracker
             //! \brief table used to store opcode that are being executed
             //!
@@ -157,7 +168,8 @@ namespace Svc {
             //! assigned sequence number for the command. The "opCode" field is
             //! used for the opcode, and the "callerPort" field is used to store
             //! the port number of the caller so the status can be reported back to
-            //! correct port.
+            //! correct port. Free slots are kept on the m_freePending stack and
+            //! pending slots are located by sequence number through m_pendingIndex.
 
             struct SequenceTracker {
                     bool used; //!< if this slot is used
@@ -167,6 +179,28 @@ namespace Svc {
                     NATIVE_INT_TYPE callerPort; //!< port command source port
             } m_sequenceTracker[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE]; //!< sequence tracking port for command completions;
 
+            //! Open-addressed hash index of sequence number to m_sequenceTracker slot
+            NATIVE_INT_TYPE m_pendingIndex[CMD_DISPATCHER_SEQUENCER_INDEX_SIZE];
+            NATIVE_INT_TYPE m_freePending[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE]; //!< stack of free m_sequenceTracker slots
+            NATIVE_UINT_TYPE m_numFreePending; //!< number of slots on m_freePending
+
+            //!  \brief Find the sequence number in the pending command index
+            //!
+            //!  \param seq the command sequence number to look up
+            //!  \return the position in m_pendingIndex holding the sequence number, or the empty position where it would be added
+            NATIVE_UINT_TYPE findPendingIndex(U32 seq) const;
+
+            //!  \brief Remove a sequence number from the pending command index
+            //!
+            //!  Frees the tracker slot and shifts later entries of the probe chain back so
+            //!  lookups never need tombstones.
+            //!
+            //!  \param position the position in m_pendingIndex returned by findPendingIndex()
+            void removePendingIndex(NATIVE_UINT_TYPE position);
+
+            //!  \brief Clear all pending commands
+            void clearPending();
+
             I32 m_seq; //!< current command sequence number
 
             U32 m_numCmdsDispatched; //!< number of commands dispatched
@@ -881,6 +881,67 @@ namespace Svc {
 
     }
 
+    void CommandDispatcherImplTester::runDispatchBursts() {
+
+        // register built-in commands, then fill the rest of the table
+        this->clearEvents();
+        this->m_impl.regCommands();
+        const U32 numOpcodes = CMD_DISPATCHER_DISPATCH_TABLE_SIZE - 4;
+        const FwOpcodeType baseOpCode = 0x1000;
+        // a stride keeps the opcodes clustered the way component base IDs are
+        const FwOpcodeType opCodeStride = 0x10;
+        for (U32 op = 0; op < numOpcodes; op++) {
+            this->invoke_to_compCmdReg(0,baseOpCode + op*opCodeStride);
+        }
+        ASSERT_EVENTS_OpCodeRegistered_SIZE(CMD_DISPATCHER_DISPATCH_TABLE_SIZE);
+        this->clearEvents();
+
+        // keep the tracking table full and complete commands in reverse order
+        // so removal from the pending index is exercised
+        const U32 numBursts = 100;
+        const U32 burstSize = CMD_DISPATCHER_SEQUENCER_TABLE_SIZE;
+        U32 seqs[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE];
+        FwOpcodeType opCodes[CMD_DISPATCHER_SEQUENCER_TABLE_SIZE];
+        U32 nextOp = 0;
+        Fw::ComBuffer buff;
+
+        for (U32 burst = 0; burst < numBursts; burst++) {
+            for (U32 cmd = 0; cmd < burstSize; cmd++) {
+                opCodes[cmd] = baseOpCode + nextOp*opCodeStride;
+                nextOp = (nextOp + 7) % numOpcodes;
+                buff.resetSer();
+                ASSERT_EQ(buff.serialize(FwPacketDescriptorType(Fw::ComPacket::FW_PACKET_COMMAND)),Fw::FW_SERIALIZE_OK);
+                ASSERT_EQ(buff.serialize(opCodes[cmd]),Fw::FW_SERIALIZE_OK);
+                this->m_cmdSendRcvd = false;
+                this->invoke_to_seqCmdBuff(0,buff,cmd);
+                ASSERT_EQ(Fw::QueuedComponentBase::MSG_DISPATCH_OK,this->m_impl.doDispatch());
+                ASSERT_TRUE(this->m_cmdSendRcvd);
+                ASSERT_EQ(opCodes[cmd],this->m_cmdSendOpCode);
+                seqs[cmd] = this->m_cmdSendCmdSeq;
+            }
+            for (U32 cmd = burstSize; cmd > 0; cmd--) {
+                this->m_seqStatusRcvd = false;
+                this->invoke_to_compCmdStat(0,opCodes[cmd-1],seqs[cmd-1],Fw::CmdResponse::OK);
+                ASSERT_TRUE(this->m_seqStatusRcvd);
+                ASSERT_EQ(opCodes[cmd-1],this->m_seqStatusOpCode);
+                // context is returned in place of the sequence number
+                ASSERT_EQ(cmd-1,this->m_seqStatusCmdSeq);
+            }
+            this->clearHistory();
+        }
+
+        // verify every command dispatched and the tracking table and pending index drained
+        ASSERT_EQ(numBursts*burstSize,this->m_impl.m_numCmdsDispatched);
+        ASSERT_EQ(0,this->m_impl.m_numCmdErrors);
+        for (NATIVE_UINT_TYPE entry = 0; entry < FW_NUM_ARRAY_ELEMENTS(this->m_impl.m_sequenceTracker); entry++) {
+            ASSERT_FALSE(this->m_impl.m_sequenceTracker[entry].used);
+        }
+        ASSERT_EQ(CMD_DISPATCHER_SEQUENCER_TABLE_SIZE,this->m_impl.m_numFreePending);
+        for (NATIVE_UINT_TYPE position = 0; position < FW_NUM_ARRAY_ELEMENTS(this->m_impl.m_pendingIndex); position++) {
+            ASSERT_EQ(-1,this->m_impl.m_pendingIndex[position]);
+        }
+    }
+
     void CommandDispatcherImplTester::from_pingOut_handler(
               const NATIVE_INT_TYPE portNum, /*!< The port number*/
               U32 key /*!< Value to return to pinger*/
@@ -28,6 +28,7 @@ namespace Svc {
             void runOverflowCommands();
             void runNopCommands();
             void runClearCommandTracking();
+            void runDispatchBursts();
 
         private:
             Svc::CommandDispatcherImpl& m_impl;
@@ -201,6 +201,25 @@ TEST(CmdDispTestOffNominal,ClearSequenceTracker) {
 
 }
 
+TEST(CmdDispTestNominal,DispatchBursts) {
+
+    TEST_CASE(102.1.4,"Dispatch Bursts");
+    COMMENT("Dispatch and complete bursts of commands with a full opcode table and a full tracking table.");
+    Svc::CommandDispatcherImpl impl("CmdDispImpl");
+
+    impl.init(10,0);
+
+    Svc::CommandDispatcherImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    tester.runDispatchBursts();
+
+}
+
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -10,6 +10,11 @@
 #include <Fw/Types/StringUtils.hpp>
 #include <Os/ValidateFile.hpp>
 #include <cstdio>
+#include <cstring>
+
+// Every record must fit in the staging buffer:
+static_assert(Svc::COMLOGGER_STAGING_BUFFER_SIZE >= FW_COM_BUFFER_MAX_SIZE + sizeof(U16),
+              "COMLOGGER_STAGING_BUFFER_SIZE must hold a full com buffer and its length");
 
 namespace Svc {
 
@@ -23,9 +28,11 @@ namespace Svc {
       maxFileSize(maxFileSize),
       fileMode(CLOSED),
       byteCount(0),
+      fileHashValid(false),
       writeErrorOccurred(false),
       openErrorOccurred(false),
-      storeBufferLength(storeBufferLength)
+      storeBufferLength(storeBufferLength),
+      stagedBytes(0)
   {
     if( this->storeBufferLength ) {
       FW_ASSERT(maxFileSize > sizeof(U16), maxFileSize); // must be a positive integer greater than buffer length size
@@ -59,6 +66,19 @@ namespace Svc {
     // faults.
     // So I am copying part of that function here.
     if( OPEN == this->fileMode ) {
+      // Write out buffered records, without the error event:
+      if( this->stagedBytes > 0 ) {
+        NATIVE_INT_TYPE size = static_cast<NATIVE_INT_TYPE>(this->stagedBytes);
+        Os::File::Status ret = this->file.write(this->stagingBuffer, size);
+        if( Os::File::OP_OK == ret && size == static_cast<NATIVE_INT_TYPE>(this->stagedBytes) ) {
+          this->fileHash.update(this->stagingBuffer, size);
+        }
+        else {
+          this->fileHashValid = false;
+        }
+        this->stagedBytes = 0;
+      }
+
       // Close file:
       this->file.close();
 
@@ -126,6 +146,29 @@ namespace Svc {
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
   }
 
+  void ComLogger ::
+    FlushFile_cmdHandler(
+      FwOpcodeType opCode,
+      U32 cmdSeq
+    )
+  {
+    if( this->flushStagingBuffer() ) {
+      this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+    }
+    else {
+      this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+    }
+  }
+
+  void ComLogger ::
+    schedIn_handler(
+        const NATIVE_INT_TYPE portNum,
+        NATIVE_UINT_TYPE context
+    )
+  {
+    (void) this->flushStagingBuffer();
+  }
+
   void ComLogger ::
     pingIn_handler(
         const NATIVE_INT_TYPE portNum,
@@ -174,6 +217,10 @@ namespace Svc {
       // Reset byte count:
       this->byteCount = 0;
 
+      // Start hashing the new file:
+      this->fileHash.init();
+      this->fileHashValid = true;
+
       // Set mode:
       this->fileMode = OPEN;
     }
@@ -184,6 +231,9 @@ namespace Svc {
     )
   {
     if( OPEN == this->fileMode ) {
+      // Write out buffered records:
+      (void) this->flushStagingBuffer();
+
       // Close file:
       this->file.close();
 
@@ -205,32 +255,53 @@ namespace Svc {
       U16 size
     )
   {
+    U32 recordSize = size;
     if( this->storeBufferLength ) {
-      U8 buffer[sizeof(size)];
-      Fw::SerialBuffer serialLength(&buffer[0], sizeof(size));
+      recordSize += sizeof(size);
+    }
+
+    // Write out the staged records if this one does not fit:
+    if( this->stagedBytes + recordSize > sizeof(this->stagingBuffer) ) {
+      (void) this->flushStagingBuffer();
+    }
+    FW_ASSERT(this->stagedBytes + recordSize <= sizeof(this->stagingBuffer), this->stagedBytes, recordSize);
+
+    // Stage the record in the same format it has on disk:
+    if( this->storeBufferLength ) {
+      Fw::SerialBuffer serialLength(&this->stagingBuffer[this->stagedBytes], sizeof(size));
       serialLength.serialize(size);
-      if(this->writeToFile(serialLength.getBuffAddr(),
-              static_cast<U16>(serialLength.getBuffLength()))) {
-        this->byteCount += serialLength.getBuffLength();
-      }
-      else {
-        return;
-      }
+      this->stagedBytes += serialLength.getBuffLength();
     }
+    (void) memcpy(&this->stagingBuffer[this->stagedBytes], data.getBuffAddr(), size);
+    this->stagedBytes += size;
+    this->byteCount += recordSize;
+  }
 
-    // Write buffer to file:
-    if(this->writeToFile(data.getBuffAddr(), size)) {
-      this->byteCount += size;
+  bool ComLogger ::
+    flushStagingBuffer(
+    )
+  {
+    if( OPEN != this->fileMode || 0 == this->stagedBytes ) {
+      return true;
     }
+
+    // Records that fail to write are dropped, and no longer count
+    // towards the file size:
+    const bool status = this->writeToFile(this->stagingBuffer, this->stagedBytes);
+    if( !status ) {
+      this->byteCount -= this->stagedBytes;
+    }
+    this->stagedBytes = 0;
+    return status;
   }
 
   bool ComLogger ::
     writeToFile(
       void* data,
-      U16 length
+      U32 length
     )
   {
-    NATIVE_INT_TYPE size = length;
+    NATIVE_INT_TYPE size = static_cast<NATIVE_INT_TYPE>(length);
     Os::File::Status ret = file.write(data, size);
     if( Os::File::OP_OK != ret || size != static_cast<NATIVE_INT_TYPE>(length) ) {
       if( !this->writeErrorOccurred ) { // throttle this event, otherwise a positive
@@ -239,9 +310,13 @@ namespace Svc {
         this->log_WARNING_HI_FileWriteError(ret, size, length, logStringArg);
       }
       this->writeErrorOccurred = true;
+      // Part of the buffer may have reached the file, so the running hash
+      // can no longer be trusted:
+      this->fileHashValid = false;
       return false;
     }
 
+    this->fileHash.update(data, size);
     this->writeErrorOccurred = false;
     return true;
   }
@@ -251,7 +326,16 @@ namespace Svc {
     )
   {
     Os::ValidateFile::Status validateStatus;
-    validateStatus = Os::ValidateFile::createValidation(this->fileName, this->hashFileName);
+    if( this->fileHashValid ) {
+      // Every byte of the file went through the running hash, so there
+      // is no need to read the file back:
+      Utils::HashBuffer hashBuffer;
+      this->fileHash.final(hashBuffer);
+      validateStatus = Os::ValidateFile::writeValidation(this->hashFileName, hashBuffer);
+    }
+    else {
+      validateStatus = Os::ValidateFile::createValidation(this->fileName, this->hashFileName);
+    }
     if( Os::ValidateFile::VALIDATION_OK != validateStatus ) {
       Fw::LogStringArg logStringArg1(this->fileName);
       Fw::LogStringArg logStringArg2(this->hashFileName);
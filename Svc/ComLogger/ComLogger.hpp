@@ -12,6 +12,7 @@
 #include <Os/Mutex.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Utils/Hash/Hash.hpp>
+#include <ComLoggerCfg.hpp>
 
 #include <limits.h>
 #include <cstdio>
@@ -69,6 +70,18 @@ namespace Svc {
           U32 cmdSeq
       );
 
+      void FlushFile_cmdHandler(
+          FwOpcodeType opCode,
+          U32 cmdSeq
+      );
+
+      //! Handler implementation for schedIn
+      //!
+      void schedIn_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          NATIVE_UINT_TYPE context /*!< The call order*/
+      );
+
       //! Handler implementation for pingIn
       //!
       void pingIn_handler(
@@ -102,10 +115,16 @@ namespace Svc {
       CHAR fileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       CHAR hashFileName[MAX_FILENAME_SIZE + MAX_PATH_SIZE];
       U32 byteCount;
+      Utils::Hash fileHash; // Running hash of the bytes written to the open file
+      bool fileHashValid; // False once a write fails, so fileHash may not match the file
       bool writeErrorOccurred;
       bool openErrorOccurred;
       bool storeBufferLength;
 
+      // Records waiting to be written to the open file:
+      U8 stagingBuffer[COMLOGGER_STAGING_BUFFER_SIZE];
+      U32 stagedBytes;
+
       // ----------------------------------------------------------------------
       // File functions:
       // ----------------------------------------------------------------------
@@ -120,13 +139,16 @@ namespace Svc {
         U16 size
       );
 
+      bool flushStagingBuffer(
+      );
+
       // ----------------------------------------------------------------------
       // Helper functions:
       // ----------------------------------------------------------------------
 
       bool writeToFile(
         void* data,
-        U16 length
+        U32 length
       );
 
       void writeHashFile(
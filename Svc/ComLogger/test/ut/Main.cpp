@@ -31,6 +31,21 @@ TEST(Test, closeFileCommand) {
   tester.closeFileCommand();
 }
 
+TEST(Test, runningHash) {
+  Svc::Tester tester("Tester");
+  tester.runningHash();
+}
+
+TEST(Test, stagingBuffer) {
+  Svc::Tester tester("Tester");
+  tester.stagingBuffer();
+}
+
+TEST(Test, stagedMatchesUnstaged) {
+  Svc::Tester tester("Tester");
+  tester.stagedMatchesUnstaged();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -38,6 +38,7 @@ namespace Svc {
     comLogger.set_cmdResponseOut_OutputPort(0, this->get_from_cmdResponseOut(0));
     this->connect_to_cmdIn(0, comLogger.get_cmdIn_InputPort(0));
     this->connect_to_comIn(0, comLogger.get_comIn_InputPort(0));
+    this->connect_to_schedIn(0, comLogger.get_schedIn_InputPort(0));
     comLogger.set_timeCaller_OutputPort(0, this->get_from_timeCaller(0));
     comLogger.set_logOut_OutputPort(0, this->get_from_logOut(0));
   }
@@ -406,6 +407,11 @@ namespace Svc {
         ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
       }
 
+      // Write out the staged packets:
+      sendCmd_FlushFile(0, 0);
+      dispatchAll();
+      ASSERT_CMD_RESPONSE(0, ComLogger::OPCODE_FLUSHFILE, 0, Fw::CmdResponse::OK);
+
       // Force close the file from underneath the component:
       comLogger.file.close();
 
@@ -416,6 +422,11 @@ namespace Svc {
         ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
       }
 
+      // Staged packets are written, and fail, on a flush:
+      sendCmd_FlushFile(0, 1);
+      dispatchAll();
+      ASSERT_CMD_RESPONSE(1, ComLogger::OPCODE_FLUSHFILE, 1, Fw::CmdResponse::EXECUTION_ERROR);
+
       // Construct filename:
       CHAR fileName[2048];
       memset(fileName, 0, sizeof(fileName));
@@ -430,7 +441,7 @@ namespace Svc {
           0,
           Os::File::NOT_OPENED,
           0,
-          2,
+          3*(sizeof(U16)+sizeof(data)),
           fileName
       );
 
@@ -446,6 +457,10 @@ namespace Svc {
         ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
       }
 
+      sendCmd_FlushFile(0, 2);
+      dispatchAll();
+      ASSERT_CMD_RESPONSE(2, ComLogger::OPCODE_FLUSHFILE, 2, Fw::CmdResponse::OK);
+
       // Expect no new errors:
       ASSERT_EVENTS_SIZE(1);
       ASSERT_EVENTS_FileWriteError_SIZE(1);
@@ -460,6 +475,10 @@ namespace Svc {
         ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
       }
 
+      sendCmd_FlushFile(0, 3);
+      dispatchAll();
+      ASSERT_CMD_RESPONSE(3, ComLogger::OPCODE_FLUSHFILE, 3, Fw::CmdResponse::EXECUTION_ERROR);
+
       // Check generated events:
       // We should only see a single event because write
       // errors are throttled.
@@ -469,7 +488,7 @@ namespace Svc {
           1,
           Os::File::NOT_OPENED,
           0,
-          2,
+          3*(sizeof(U16)+sizeof(data)),
           fileName
       );
   }
@@ -553,6 +572,234 @@ namespace Svc {
     file.close();
   }
 
+  void Tester ::
+    runningHash()
+  {
+    CHAR fileName[2048];
+    CHAR hashFileName[2048];
+    CHAR refHashFileName[2048];
+    Os::File file;
+    Utils::HashBuffer reference;
+    Os::ValidateFile::Status status;
+
+    ASSERT_TRUE(comLogger.fileMode == ComLogger::CLOSED);
+
+    for(int j = 0; j < 2; j++)
+    {
+      Fw::Time testTime(TB_NONE, 7+j, 9876543);
+      setTestTime(testTime);
+      memset(fileName, 0, sizeof(fileName));
+      snprintf(fileName, sizeof(fileName), "%s_%d_%d_%06d.com", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds());
+      memset(hashFileName, 0, sizeof(hashFileName));
+      snprintf(hashFileName, sizeof(hashFileName), "%s_%d_%d_%06d.com%s", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds(), Utils::Hash::getFileExtensionString());
+      memset(refHashFileName, 0, sizeof(refHashFileName));
+      snprintf(refHashFileName, sizeof(refHashFileName), "%s_%d_%d_%06d.com%s.ref", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds(), Utils::Hash::getFileExtensionString());
+
+      // Log buffers of different sizes and contents:
+      for(int i = 0; i < 3; i++)
+      {
+        U8 data[COM_BUFFER_LENGTH];
+        for(U32 k = 0; k < COM_BUFFER_LENGTH; k++) {
+          data[k] = static_cast<U8>(0x10*i + k);
+        }
+        Fw::ComBuffer buffer(data, COM_BUFFER_LENGTH - i);
+        invoke_to_comIn(0, buffer, 0);
+        dispatchAll();
+        ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
+      }
+
+      // The second file loses a write, so its hash must come from
+      // reading the file back:
+      if( j == 1 ) {
+        ASSERT_TRUE(comLogger.fileHashValid);
+        comLogger.file.close();
+        const U8 data[COM_BUFFER_LENGTH] = {0xde,0xad,0xbe,0xef};
+        Fw::ComBuffer buffer(data, sizeof(data));
+        invoke_to_comIn(0, buffer, 0);
+        sendCmd_FlushFile(0, j);
+        dispatchAll();
+        ASSERT_FALSE(comLogger.fileHashValid);
+        ASSERT_EVENTS_FileWriteError_SIZE(1);
+      }
+
+      sendCmd_CloseFile(0, j);
+      dispatchAll();
+      ASSERT_TRUE(comLogger.fileMode == ComLogger::CLOSED);
+
+      // The hash file written at close must be identical to one created
+      // by reading the closed file back:
+      status = Os::ValidateFile::validate(fileName, hashFileName);
+      ASSERT_EQ(Os::ValidateFile::VALIDATION_OK, status);
+      status = Os::ValidateFile::createValidation(fileName, refHashFileName, reference);
+      ASSERT_EQ(Os::ValidateFile::VALIDATION_OK, status);
+      U8 written[2*HASH_DIGEST_LENGTH];
+      NATIVE_INT_TYPE writtenSize = sizeof(written);
+      ASSERT_EQ(Os::File::OP_OK, file.open(hashFileName, Os::File::OPEN_READ));
+      ASSERT_EQ(Os::File::OP_OK, file.read(written, writtenSize));
+      file.close();
+      ASSERT_EQ(static_cast<NATIVE_INT_TYPE>(reference.getBuffLength()), writtenSize);
+      ASSERT_EQ(0, memcmp(written, reference.getBuffAddr(), writtenSize));
+      (void) Os::FileSystem::removeFile(refHashFileName);
+    }
+    ASSERT_EVENTS_FileValidationError_SIZE(0);
+  }
+
+  void Tester ::
+    stagingBuffer()
+  {
+    CHAR fileName[2048];
+    U64 fileSize = 0;
+    Os::File file;
+    U8 buf[COMLOGGER_STAGING_BUFFER_SIZE];
+    NATIVE_INT_TYPE length;
+
+    Fw::Time testTime(TB_NONE, 9, 9876543);
+    setTestTime(testTime);
+    memset(fileName, 0, sizeof(fileName));
+    snprintf(fileName, sizeof(fileName), "%s_%d_%d_%06d.com", FILE_STR, testTime.getTimeBase(), testTime.getSeconds(), testTime.getUSeconds());
+
+    const U8 data[COM_BUFFER_LENGTH] = {0xde,0xad,0xbe,0xef};
+    Fw::ComBuffer buffer(data, sizeof(data));
+    const U32 recordSize = sizeof(U16) + sizeof(data);
+
+    // Packets are held in the staging buffer:
+    for(int i = 0; i < 2; i++) {
+      invoke_to_comIn(0, buffer, 0);
+      dispatchAll();
+      ASSERT_TRUE(comLogger.fileMode == ComLogger::OPEN);
+    }
+    ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize(fileName, fileSize));
+    ASSERT_EQ(0U, fileSize);
+
+    // A schedIn tick writes them out:
+    invoke_to_schedIn(0, 0);
+    dispatchAll();
+    ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize(fileName, fileSize));
+    ASSERT_EQ(2*recordSize, fileSize);
+
+    // So does the flush command:
+    invoke_to_comIn(0, buffer, 0);
+    sendCmd_FlushFile(0, 1);
+    dispatchAll();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ComLogger::OPCODE_FLUSHFILE, 1, Fw::CmdResponse::OK);
+    ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize(fileName, fileSize));
+    ASSERT_EQ(3*recordSize, fileSize);
+
+    // Flushing with nothing staged, or with no file open, succeeds:
+    sendCmd_FlushFile(0, 2);
+    sendCmd_CloseFile(0, 3);
+    sendCmd_FlushFile(0, 4);
+    dispatchAll();
+    ASSERT_CMD_RESPONSE_SIZE(4);
+    ASSERT_CMD_RESPONSE(1, ComLogger::OPCODE_FLUSHFILE, 2, Fw::CmdResponse::OK);
+    ASSERT_CMD_RESPONSE(3, ComLogger::OPCODE_FLUSHFILE, 4, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_FileWriteError_SIZE(0);
+
+    // A full staging buffer is written out when the next packet arrives.
+    // Use a logger whose files can hold more than the staging buffer:
+    const U32 bigRecords = COMLOGGER_STAGING_BUFFER_SIZE / (sizeof(U16) + COM_BUFFER_LENGTH);
+    ComLogger bigLogger("BigComLogger", "big", 2*COMLOGGER_STAGING_BUFFER_SIZE);
+    bigLogger.init(QUEUE_DEPTH, 0);
+    for(U32 i = 0; i < bigRecords; i++) {
+      U8 record[COM_BUFFER_LENGTH];
+      memset(record, static_cast<U8>(i), sizeof(record));
+      Fw::ComBuffer recordBuffer(record, sizeof(record));
+      bigLogger.comIn_handler(0, recordBuffer, 0);
+    }
+    ASSERT_TRUE(bigLogger.fileMode == ComLogger::OPEN);
+    ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize(bigLogger.fileName, fileSize));
+    ASSERT_EQ(0U, fileSize);
+    bigLogger.comIn_handler(0, buffer, 0);
+    ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize(bigLogger.fileName, fileSize));
+    ASSERT_EQ(bigRecords*recordSize, fileSize);
+
+    // Closing writes the rest, with the same layout as unstaged writes:
+    bigLogger.closeFile();
+    ASSERT_EQ(Os::File::OP_OK, file.open(bigLogger.fileName, Os::File::OPEN_READ));
+    for(U32 i = 0; i <= bigRecords; i++) {
+      length = recordSize;
+      ASSERT_EQ(Os::File::OP_OK, file.read(buf, length));
+      ASSERT_EQ(static_cast<NATIVE_INT_TYPE>(recordSize), length);
+      Fw::SerialBuffer comBuffLength(buf, sizeof(U16));
+      comBuffLength.fill();
+      U16 bufferSize = 0;
+      ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuffLength.deserialize(bufferSize));
+      ASSERT_EQ(COM_BUFFER_LENGTH, bufferSize);
+      if( i < bigRecords ) {
+        ASSERT_EQ(static_cast<U8>(i), buf[sizeof(U16)]);
+      }
+      else {
+        ASSERT_EQ(0, memcmp(&buf[sizeof(U16)], data, sizeof(data)));
+      }
+    }
+    length = sizeof(buf);
+    ASSERT_EQ(Os::File::OP_OK, file.read(buf, length));
+    ASSERT_EQ(0, length);
+    file.close();
+    ASSERT_EQ(Os::ValidateFile::VALIDATION_OK, Os::ValidateFile::validate(bigLogger.fileName, bigLogger.hashFileName));
+  }
+
+  void Tester ::
+    stagedMatchesUnstaged()
+  {
+    // Enough records to fill the staging buffer several times
+    const U32 numPackets = 1000;
+    const U32 packetSize = 30;
+    U8 data[packetSize];
+    memset(data, 0xa5, sizeof(data));
+    Fw::ComBuffer buffer(data, sizeof(data));
+
+    // Packets through the staging buffer:
+    ComLogger stagedLogger("StagedComLogger", "staged", numPackets*(packetSize + sizeof(U16)));
+    stagedLogger.init(QUEUE_DEPTH, 0);
+    for(U32 i = 0; i < numPackets; i++) {
+      stagedLogger.comIn_handler(0, buffer, 0);
+    }
+    stagedLogger.closeFile();
+    U64 fileSize = 0;
+    ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize(stagedLogger.fileName, fileSize));
+    ASSERT_EQ(numPackets*(packetSize + sizeof(U16)), fileSize);
+
+    // The same packets written one length and one payload at a time:
+    Os::File file;
+    ASSERT_EQ(Os::File::OP_OK, file.open("unstaged.com", Os::File::OPEN_WRITE));
+    for(U32 i = 0; i < numPackets; i++) {
+      U8 sizeBuffer[sizeof(U16)];
+      Fw::SerialBuffer serialLength(sizeBuffer, sizeof(sizeBuffer));
+      serialLength.serialize(static_cast<U16>(packetSize));
+      NATIVE_INT_TYPE size = sizeof(sizeBuffer);
+      ASSERT_EQ(Os::File::OP_OK, file.write(sizeBuffer, size));
+      size = packetSize;
+      ASSERT_EQ(Os::File::OP_OK, file.write(data, size));
+    }
+    file.close();
+
+    // Staging does not change the bytes written
+    U64 unstagedSize = 0;
+    ASSERT_EQ(Os::FileSystem::OP_OK, Os::FileSystem::getFileSize("unstaged.com", unstagedSize));
+    ASSERT_EQ(fileSize, unstagedSize);
+    Os::File staged;
+    Os::File unstaged;
+    ASSERT_EQ(Os::File::OP_OK, staged.open(stagedLogger.fileName, Os::File::OPEN_READ));
+    ASSERT_EQ(Os::File::OP_OK, unstaged.open("unstaged.com", Os::File::OPEN_READ));
+    for(U32 i = 0; i < numPackets; i++) {
+      U8 stagedRecord[packetSize + sizeof(U16)];
+      U8 unstagedRecord[packetSize + sizeof(U16)];
+      NATIVE_INT_TYPE size = sizeof(stagedRecord);
+      ASSERT_EQ(Os::File::OP_OK, staged.read(stagedRecord, size));
+      ASSERT_EQ(static_cast<NATIVE_INT_TYPE>(sizeof(stagedRecord)), size);
+      size = sizeof(unstagedRecord);
+      ASSERT_EQ(Os::File::OP_OK, unstaged.read(unstagedRecord, size));
+      ASSERT_EQ(static_cast<NATIVE_INT_TYPE>(sizeof(unstagedRecord)), size);
+      ASSERT_EQ(0, memcmp(stagedRecord, unstagedRecord, sizeof(stagedRecord)));
+    }
+    staged.close();
+    unstaged.close();
+
+    (void) Os::FileSystem::removeFile("unstaged.com");
+  }
+
   void Tester ::
     from_pingOut_handler(
         const NATIVE_INT_TYPE portNum,
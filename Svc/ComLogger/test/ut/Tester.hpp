@@ -31,6 +31,9 @@ namespace Svc {
       void openError();
       void writeError();
       void closeFileCommand();
+      void runningHash();
+      void stagingBuffer();
+      void stagedMatchesUnstaged();
     private:
       void connectPorts();
       void initComponents();
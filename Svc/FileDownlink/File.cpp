@@ -14,6 +14,7 @@
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/BasicTypes.hpp>
 #include <Os/FileSystem.hpp>
+#include <cstring>
 
 namespace Svc {
 
@@ -44,6 +45,11 @@ namespace Svc {
     CFDP::Checksum checksum;
     this->checksum = checksum;
 
+    // Empty the read-ahead buffer
+    this->filePosition = 0;
+    this->readAheadOffset = 0;
+    this->readAheadLength = 0;
+
     // Open osFile for reading
     return this->osFile.open(sourceFileName, Os::File::OPEN_READ);
 
@@ -58,17 +64,62 @@ namespace Svc {
   {
 
     Os::File::Status status;
-    status = this->osFile.seek(byteOffset);
-    if (status != Os::File::OP_OK)
-      return status;
+    if (
+        byteOffset >= this->readAheadOffset &&
+        byteOffset + size <= this->readAheadOffset + this->readAheadLength
+    ) {
+      // Serve the read from the read-ahead buffer. The copy is the price
+      // of the saved read call; see FILEDOWNLINK_READ_AHEAD_SIZE
+      (void) ::memcpy(data, &this->readAhead[byteOffset - this->readAheadOffset], size);
+    }
+    else if (size > FILEDOWNLINK_READ_AHEAD_SIZE || byteOffset + size > this->size) {
+      // The read does not fit in the read-ahead buffer, so read it directly
+      status = this->readOsFile(data, byteOffset, size);
+      if (status != Os::File::OP_OK)
+        return status;
+    }
+    else {
+      // Refill the read-ahead buffer starting at byteOffset
+      const U32 remaining = this->size - byteOffset;
+      const U32 fillSize = (remaining < FILEDOWNLINK_READ_AHEAD_SIZE) ?
+        remaining : FILEDOWNLINK_READ_AHEAD_SIZE;
+      this->readAheadLength = 0;
+      status = this->readOsFile(this->readAhead, byteOffset, fillSize);
+      if (status != Os::File::OP_OK)
+        return status;
+      this->readAheadOffset = byteOffset;
+      this->readAheadLength = fillSize;
+      (void) ::memcpy(data, this->readAhead, size);
+    }
+
+    this->checksum.update(data, byteOffset, size);
+
+    return Os::File::OP_OK;
+
+  }
+
+  Os::File::Status FileDownlink::File ::
+    readOsFile(
+        U8 *const data,
+        const U32 byteOffset,
+        const U32 size
+    )
+  {
+
+    Os::File::Status status;
+    if (byteOffset != this->filePosition) {
+      status = this->osFile.seek(byteOffset);
+      if (status != Os::File::OP_OK)
+        return status;
+      this->filePosition = byteOffset;
+    }
 
     NATIVE_INT_TYPE intSize = size;
     status = this->osFile.read(data, intSize);
     if (status != Os::File::OP_OK)
       return status;
     FW_ASSERT(static_cast<U32>(intSize) == size);
-
-    this->checksum.update(data, byteOffset, size);
+    this->filePosition += size;
 
     return Os::File::OP_OK;
 
@@ -28,6 +28,9 @@ namespace Svc {
     ) :
       FileDownlinkComponentBase(name),
       configured(false),
+      windowSize(1),
+      numOutstanding(0),
+      firstBufferId(0),
       filesSent(this),
       packetsSent(this),
       warnings(this),
@@ -41,6 +44,9 @@ namespace Svc {
       curEntry(),
       cntxId(0)
   {
+    for (U32 i = 0; i < FILEDOWNLINK_MAX_WINDOW_SIZE; i++) {
+      this->bufferOutstanding[i] = false;
+    }
   }
 
   void FileDownlink ::
@@ -57,12 +63,15 @@ namespace Svc {
         U32 timeout,
         U32 cooldown,
         U32 cycleTime,
-        U32 fileQueueDepth
+        U32 fileQueueDepth,
+        U32 windowSize
     )
   {
+    FW_ASSERT(windowSize > 0 && windowSize <= FILEDOWNLINK_MAX_WINDOW_SIZE, windowSize);
     this->timeout = timeout;
     this->cooldown = cooldown;
     this->cycleTime = cycleTime;
+    this->windowSize = windowSize;
     this->configured = true;
 
     Os::Queue::QueueStatus stat = fileQueue.create(
@@ -194,17 +203,26 @@ namespace Svc {
     )
   {
 	  //If this is a stale buffer (old, timed-out, or both), then ignore its return.
-	  //File downlink actions only respond to the return of the most-recently-sent buffer.
-	  if (this->lastBufferId != fwBuffer.getContext() + 1 ||
+	  //File downlink actions only respond to the return of buffers sent for the current file.
+	  const U32 bufferId = fwBuffer.getContext();
+	  const U32 index = bufferId % this->windowSize;
+	  if (bufferId - this->firstBufferId >= this->lastBufferId - this->firstBufferId ||
+	      not this->bufferOutstanding[index] ||
 	      this->mode.get() == Mode::IDLE) {
 		  return;
 	  }
 	  //Non-ignored buffers cannot be returned in "DOWNLINK" and "IDLE" state.  Only in "WAIT", "CANCEL" state.
 	  FW_ASSERT(this->mode.get() == Mode::WAIT || this->mode.get() == Mode::CANCEL, this->mode.get());
-      //If the last packet has been sent (and is returning now) then finish the file
+	  this->bufferOutstanding[index] = false;
+	  FW_ASSERT(this->numOutstanding > 0);
+	  --this->numOutstanding;
+	  this->curTimer = 0;
+      //If the last packet has been sent, finish the file once every packet has returned
 	  if (this->lastCompletedType == Fw::FilePacket::T_END ||
           this->lastCompletedType == Fw::FilePacket::T_CANCEL) {
-          finishHelper(this->lastCompletedType == Fw::FilePacket::T_CANCEL);
+          if (this->numOutstanding == 0) {
+              finishHelper(this->lastCompletedType == Fw::FilePacket::T_CANCEL);
+          }
           return;
       }
       //If waiting and a buffer is in-bound, then switch to downlink mode
@@ -371,7 +389,11 @@ namespace Svc {
     }
 
     // Send file and switch to WAIT mode
-    this->getBuffer(this->buffer, FILE_PACKET);
+    this->firstBufferId = this->lastBufferId;
+    this->numOutstanding = 0;
+    for (U32 i = 0; i < FILEDOWNLINK_MAX_WINDOW_SIZE; i++) {
+      this->bufferOutstanding[i] = false;
+    }
     this->sendStartPacket();
     this->mode.set(Mode::WAIT);
     this->sequenceIndex = 1;
@@ -388,6 +410,12 @@ namespace Svc {
         this->log_ACTIVITY_HI_SendStarted(this->file.size - startOffset, this->file.sourceName, this->file.destName);
         this->endOffset = this->file.size;
     }
+
+    // Fill the rest of the window without waiting for the start packet to return
+    if (this->windowHasRoom()) {
+        this->mode.set(Mode::DOWNLINK);
+        this->downlinkPacket();
+    }
   }
 
   Os::File::Status FileDownlink ::
@@ -396,15 +424,19 @@ namespace Svc {
     FW_ASSERT(byteOffset < this->endOffset);
     const U32 maxDataSize = FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE;
     const U32 dataSize = (byteOffset + maxDataSize > this->endOffset) ? (this->endOffset - byteOffset) : maxDataSize;
-    U8 buffer[FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE];
     //This will be last data packet sent
     if (dataSize + byteOffset == this->endOffset) {
         this->lastCompletedType = Fw::FilePacket::T_DATA;
     }
 
+    //Read the file data straight into the outgoing buffer, so it is not copied again
+    Fw::Buffer buffer;
+    this->getBuffer(buffer);
+    U8 *const data = Fw::FilePacket::DataPacket::getDataAddress(buffer);
     const Os::File::Status status =
-      this->file.read(buffer, byteOffset, dataSize);
+      this->file.read(data, byteOffset, dataSize);
     if (status != Os::File::OP_OK) {
+      //The file is abandoned, so the unsent buffer is not released
       this->warnings.fileRead(status);
       return status;
     }
@@ -413,12 +445,12 @@ namespace Svc {
       { Fw::FilePacket::T_DATA, this->sequenceIndex },
       byteOffset,
       static_cast<U16>(dataSize),
-      buffer
+      data
     };
     ++this->sequenceIndex;
     Fw::FilePacket filePacket;
     filePacket.fromDataPacket(dataPacket);
-    this->sendFilePacket(filePacket);
+    this->sendFilePacket(filePacket, buffer);
 
     byteOffset += dataSize;
 
@@ -429,19 +461,13 @@ namespace Svc {
   void FileDownlink ::
     sendCancelPacket()
   {
-    Fw::Buffer buffer;
     const Fw::FilePacket::CancelPacket cancelPacket = {
       { Fw::FilePacket::T_CANCEL, this->sequenceIndex }
     };
 
     Fw::FilePacket filePacket;
     filePacket.fromCancelPacket(cancelPacket);
-    this->getBuffer(buffer, CANCEL_PACKET);
-
-    const Fw::SerializeStatus status = filePacket.toBuffer(buffer);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK);
-    this->bufferSendOut_out(0, buffer);
-    this->packetsSent.packetSent();
+    this->sendFilePacket(filePacket);
   }
 
   void FileDownlink ::
@@ -480,17 +506,22 @@ namespace Svc {
 
   void FileDownlink ::
     sendFilePacket(const Fw::FilePacket& filePacket)
+  {
+    Fw::Buffer buffer;
+    this->getBuffer(buffer);
+    this->sendFilePacket(filePacket, buffer);
+  }
+
+  void FileDownlink ::
+    sendFilePacket(const Fw::FilePacket& filePacket, Fw::Buffer& buffer)
   {
     const U32 bufferSize = filePacket.bufferSize();
-    FW_ASSERT(this->buffer.getData() != nullptr);
-    FW_ASSERT(this->buffer.getSize() >= bufferSize, bufferSize, this->buffer.getSize());
-    const Fw::SerializeStatus status = filePacket.toBuffer(this->buffer);
+    FW_ASSERT(buffer.getSize() >= bufferSize, bufferSize, buffer.getSize());
+    const Fw::SerializeStatus status = filePacket.toBuffer(buffer);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK);
     // set the buffer size to the packet size
-    this->buffer.setSize(bufferSize);
-    this->bufferSendOut_out(0, this->buffer);
-    // restore buffer size to max
-    this->buffer.setSize(FILEDOWNLINK_INTERNAL_BUFFER_SIZE);
+    buffer.setSize(bufferSize);
+    this->bufferSendOut_out(0, buffer);
     this->packetsSent.packetSent();
   }
 
@@ -500,6 +531,8 @@ namespace Svc {
     this->file.osFile.close();
     this->mode.set(Mode::COOLDOWN);
     this->lastCompletedType = Fw::FilePacket::T_NONE;
+    // Buffers still out belong to a finished file; ignore their return
+    this->firstBufferId = this->lastBufferId;
     this->curTimer = 0;
   }
 
@@ -508,27 +541,34 @@ namespace Svc {
   {
       FW_ASSERT(this->lastCompletedType != Fw::FilePacket::T_NONE, this->lastCompletedType);
       FW_ASSERT(this->mode.get() == Mode::CANCEL || this->mode.get() == Mode::DOWNLINK, this->mode.get());
-      //If canceled mode and currently downlinking data then send a cancel packet
-      if (this->mode.get() == Mode::CANCEL && this->lastCompletedType == Fw::FilePacket::T_START) {
-          this->sendCancelPacket();
-          this->lastCompletedType = Fw::FilePacket::T_CANCEL;
-      }
-      //If in downlink mode and currently downlinking data then continue with the next packer
-      else if (this->mode.get() == Mode::DOWNLINK && this->lastCompletedType == Fw::FilePacket::T_START) {
-          //Send the next packet, or fail doing so
-          const Os::File::Status status = this->sendDataPacket(this->byteOffset);
-          if (status != Os::File::OP_OK) {
-              this->log_WARNING_HI_SendDataFail(this->file.sourceName, this->byteOffset);
-              this->enterCooldown();
-              this->sendResponse(FILEDOWNLINK_COMMAND_FAILURES_DISABLED ? SendFileStatus::STATUS_OK : SendFileStatus::STATUS_ERROR);
-              //Don't go to wait state
-              return;
+      //Send packets until the window is full or there is nothing left to send
+      while (this->windowHasRoom()) {
+          //If canceled mode and currently downlinking data then send a cancel packet
+          if (this->mode.get() == Mode::CANCEL && this->lastCompletedType == Fw::FilePacket::T_START) {
+              this->sendCancelPacket();
+              this->lastCompletedType = Fw::FilePacket::T_CANCEL;
+          }
+          //If in downlink mode and currently downlinking data then continue with the next packer
+          else if (this->mode.get() == Mode::DOWNLINK && this->lastCompletedType == Fw::FilePacket::T_START) {
+              //Send the next packet, or fail doing so
+              const Os::File::Status status = this->sendDataPacket(this->byteOffset);
+              if (status != Os::File::OP_OK) {
+                  this->log_WARNING_HI_SendDataFail(this->file.sourceName, this->byteOffset);
+                  this->enterCooldown();
+                  this->sendResponse(FILEDOWNLINK_COMMAND_FAILURES_DISABLED ? SendFileStatus::STATUS_OK : SendFileStatus::STATUS_ERROR);
+                  //Don't go to wait state
+                  return;
+              }
+          }
+          //If in downlink mode or cancel and finished downlinking data then send the last packet
+          else if (this->lastCompletedType == Fw::FilePacket::T_DATA) {
+              this->sendEndPacket();
+              this->lastCompletedType = Fw::FilePacket::T_END;
+          }
+          //The end or cancel packet has been sent; wait for the returns
+          else {
+              break;
           }
-      }
-      //If in downlink mode or cancel and finished downlinking data then send the last packet
-      else if (this->lastCompletedType == Fw::FilePacket::T_DATA) {
-          this->sendEndPacket();
-          this->lastCompletedType = Fw::FilePacket::T_END;
       }
       this->mode.set(Mode::WAIT);
       this->curTimer = 0;
@@ -549,15 +589,26 @@ namespace Svc {
   }
 
   void FileDownlink ::
-    getBuffer(Fw::Buffer& buffer, PacketType type)
+    getBuffer(Fw::Buffer& buffer)
   {
-      //Check type is correct
-      FW_ASSERT(type < COUNT_PACKET_TYPE && type >= 0, type);
+      //Buffers are used in turn, so the ring slot follows from the ID
+      const U32 index = this->lastBufferId % this->windowSize;
+      FW_ASSERT(not this->bufferOutstanding[index], index);
+      this->bufferOutstanding[index] = true;
+      ++this->numOutstanding;
       // Wrap the buffer around our indexed memory.
-      buffer.setData(this->memoryStore[type]);
+      buffer.setData(this->memoryStore[index]);
       buffer.setSize(FILEDOWNLINK_INTERNAL_BUFFER_SIZE);
       //Set a known ID to look for later
       buffer.setContext(lastBufferId);
       lastBufferId++;
   }
+
+  bool FileDownlink ::
+    windowHasRoom()
+  {
+      //Buffers may be returned out of order; the next slot must be free as well
+      return this->numOutstanding < this->windowSize &&
+          not this->bufferOutstanding[this->lastBufferId % this->windowSize];
+  }
 } // end namespace Svc
@@ -77,7 +77,12 @@ namespace Svc {
         public:
 
           //! Constructor
-          File() : size(0) { }
+          File() :
+            size(0),
+            filePosition(0),
+            readAheadOffset(0),
+            readAheadLength(0)
+          { }
 
         public:
 
@@ -98,6 +103,27 @@ namespace Svc {
           //! The checksum for the file
           CFDP::Checksum checksum;
 
+          //! The current position of the OS file
+          U32 filePosition;
+
+          //! The file offset of the first byte in the read-ahead buffer
+          U32 readAheadOffset;
+
+          //! The number of valid bytes in the read-ahead buffer
+          U32 readAheadLength;
+
+          //! The read-ahead buffer
+          U8 readAhead[FILEDOWNLINK_READ_AHEAD_SIZE];
+
+        PRIVATE:
+
+          //! Read bytes from the OS file, seeking only if needed
+          Os::File::Status readOsFile(
+              U8 *const data,
+              const U32 byteOffset,
+              const U32 size
+          );
+
         public:
 
           //! Open the OS file for reading and initialize the checksum
@@ -106,7 +132,8 @@ namespace Svc {
               const char *const destFileName //!< The destination file name
           );
 
-          //! Read bytes from the OS file and update the checksum
+          //! Read bytes from the file and update the checksum
+          //! Sequential reads are served from the read-ahead buffer
           Os::File::Status read(
               U8 *const data,
               const U32 byteOffset,
@@ -228,14 +255,6 @@ namespace Svc {
         U32 context; // Context id of request, only set for PORT sources.
       };
 
-      //! Enumeration for packet types
-      //! Each type has a buffer to store it.
-      enum PacketType {
-          FILE_PACKET,
-          CANCEL_PACKET,
-          COUNT_PACKET_TYPE
-      };
-
     public:
 
       // ----------------------------------------------------------------------
@@ -261,7 +280,8 @@ namespace Svc {
           U32 timeout, //!< Timeout threshold (milliseconds) while in WAIT state
           U32 cooldown, //!< Cooldown (in ms) between finishing a downlink and starting the next file.
           U32 cycleTime, //!< Rate at which we are running
-          U32 fileQueueDepth //!< Max number of items in file downlink queue
+          U32 fileQueueDepth, //!< Max number of items in file downlink queue
+          U32 windowSize = 1 //!< Max number of packets sent and not yet returned; at most FILEDOWNLINK_MAX_WINDOW_SIZE
       );
 
       //! Start FileDownlink component
@@ -367,13 +387,17 @@ namespace Svc {
       void sendEndPacket();
       void sendStartPacket();
       void sendFilePacket(const Fw::FilePacket& filePacket);
+      void sendFilePacket(const Fw::FilePacket& filePacket, Fw::Buffer& buffer);
 
       //State-helper functions
       void exitFileTransfer();
       void enterCooldown();
 
       //Function to acquire a buffer internally
-      void getBuffer(Fw::Buffer& buffer, PacketType type);
+      void getBuffer(Fw::Buffer& buffer);
+
+      //Whether another packet may be sent before a buffer is returned
+      bool windowHasRoom();
       //Downlink the "next" packet
       void downlinkPacket();
       //Finish the file transfer
@@ -395,8 +419,20 @@ namespace Svc {
       //! File downlink queue
       Os::Queue fileQueue;
 
-      //!Buffer's memory backing
-      U8 memoryStore[COUNT_PACKET_TYPE][FILEDOWNLINK_INTERNAL_BUFFER_SIZE];
+      //!Buffer's memory backing, used as a ring
+      U8 memoryStore[FILEDOWNLINK_MAX_WINDOW_SIZE][FILEDOWNLINK_INTERNAL_BUFFER_SIZE];
+
+      //! Max number of packets sent and not yet returned
+      U32 windowSize;
+
+      //! Whether each buffer is waiting to be returned
+      bool bufferOutstanding[FILEDOWNLINK_MAX_WINDOW_SIZE];
+
+      //! Number of buffers waiting to be returned
+      U32 numOutstanding;
+
+      //! First buffer id of the current file; returns of earlier ids are stale
+      U32 firstBufferId;
 
       //! The mode
       Mode mode;
@@ -428,9 +464,6 @@ namespace Svc {
       //! rate (milliseconds) at which we are running
       U32 cycleTime;
 
-      ////! Buffer for sending file data
-      Fw::Buffer buffer;
-
       //! Buffer size for file data
       U32 bufferSize;
 
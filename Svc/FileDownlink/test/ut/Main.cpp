@@ -39,6 +39,21 @@ TEST(FileDownlink, SendFilePort) {
     tester.sendFilePort();
 }
 
+TEST(FileDownlink, DownlinkWindow) {
+    Svc::Tester tester;
+    tester.downlinkWindow();
+}
+
+TEST(FileDownlink, CancelWindow) {
+    Svc::Tester tester;
+    tester.cancelWindow();
+}
+
+TEST(FileDownlink, ReadAhead) {
+    Svc::Tester tester;
+    tester.readAhead();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
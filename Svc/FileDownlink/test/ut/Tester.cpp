@@ -10,7 +10,10 @@
 // ======================================================================
 
 #include <cerrno>
+#include <cstdio>
+#include <cstring>
 #include <unistd.h>
+#include <vector>
 
 #include "Tester.hpp"
 
@@ -22,6 +25,7 @@
 #define COOLDOWN_MS 500
 #define CYCLE_MS 100
 #define MAX_ALLOCATED 100
+#define RETURN_DELAY_CYCLES 3
 namespace Svc {
 
   // ----------------------------------------------------------------------
@@ -32,7 +36,11 @@ namespace Svc {
     Tester() :
       FileDownlinkGTestBase("Tester", MAX_HISTORY_SIZE),
       component("FileDownlink"),
-      buffers_index(0)
+      buffers_index(0),
+      returnDelay(0),
+      cycle(0),
+      numDelayed(0),
+      maxDelayed(0)
   {
     this->component.configure(TIMEOUT_MS, COOLDOWN_MS, CYCLE_MS, 10);
     this->connectPorts();
@@ -389,6 +397,169 @@ namespace Svc {
     this->removeFile(sourceFileName);
   }
 
+  void Tester ::
+    downlinkWindow()
+  {
+    // Create a file that takes several data packets
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[900];
+    for (U32 i = 0; i < sizeof(data); ++i) {
+      data[i] = static_cast<U8>(i);
+    }
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+    CFDP::Checksum checksum;
+    fileBufferOut.getChecksum(checksum);
+    const U32 dataSize = FILEDOWNLINK_INTERNAL_BUFFER_SIZE - Fw::FilePacket::DataPacket::HEADERSIZE;
+    const U32 numPackets = 2 + (sizeof(data) + dataSize - 1) / dataSize;
+    ASSERT_LE(numPackets, MAX_HISTORY_SIZE);
+
+    U32 cycles[2];
+    const U32 windowSizes[2] = { 1, FILEDOWNLINK_MAX_WINDOW_SIZE };
+    for (U32 i = 0; i < 2; ++i) {
+      this->clearHistory();
+      this->component.windowSize = windowSizes[i];
+      this->sendFileDelayed(sourceFileName, destFileName, cycles[i]);
+
+      // The window does not change the packets or their order
+      ASSERT_EVENTS_FileSent_SIZE(1);
+      History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+      validatePacketHistory(
+          *this->fromPortHistory_bufferSendOut,
+          dataPackets,
+          Fw::FilePacket::T_END,
+          numPackets,
+          checksum,
+          0
+      );
+      FileBuffer fileBufferIn(dataPackets);
+      ASSERT_EQ(true, FileBuffer::compare(fileBufferIn, fileBufferOut));
+
+      // The link held at most a window of packets
+      ASSERT_EQ(FW_MIN(windowSizes[i], numPackets), this->maxDelayed);
+    }
+
+    // Waiting for each packet costs a return delay per packet
+    ASSERT_EQ(numPackets * RETURN_DELAY_CYCLES, cycles[0]);
+    // A full window keeps FILEDOWNLINK_MAX_WINDOW_SIZE packets on the link
+    const U32 windows = (numPackets + FILEDOWNLINK_MAX_WINDOW_SIZE - 1) / FILEDOWNLINK_MAX_WINDOW_SIZE;
+    ASSERT_EQ(windows * RETURN_DELAY_CYCLES, cycles[1]);
+
+    this->removeFile(sourceFileName);
+  }
+
+  void Tester ::
+    cancelWindow()
+  {
+    // Create a file that takes several data packets
+    const char *const sourceFileName = "source.bin";
+    const char *const destFileName = "dest.bin";
+    U8 data[900] = { 0 };
+    FileBuffer fileBufferOut(data, sizeof(data));
+    fileBufferOut.write(sourceFileName);
+
+    // Start the downlink; the start packet and the first data packets fill the window
+    this->component.windowSize = FILEDOWNLINK_MAX_WINDOW_SIZE;
+    this->returnDelay = RETURN_DELAY_CYCLES;
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFile(
+        INSTANCE,
+        CMD_SEQ,
+        sourceCmdStringArg,
+        destCmdStringArg
+    );
+    this->component.doDispatch();
+    this->runDelayedCycle();
+    ASSERT_from_bufferSendOut_SIZE(FILEDOWNLINK_MAX_WINDOW_SIZE);
+
+    // Cancel, then let the outstanding packets return
+    this->cancel(Fw::CmdResponse::OK);
+    this->cmdResponseHistory->clear();
+    ASSERT_EQ(FileDownlink::Mode::CANCEL, this->component.mode.get());
+    while (this->cmdResponseHistory->size() == 0) {
+      this->runDelayedCycle();
+    }
+
+    // The cancel packet follows the last data packet sent, and the file
+    // completes only once every packet has returned
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, Fw::CmdResponse::OK);
+    ASSERT_EQ(0U, this->numDelayed);
+    ASSERT_EQ(0U, this->component.numOutstanding);
+    ASSERT_EVENTS_DownlinkCanceled_SIZE(1);
+    History<Fw::FilePacket::DataPacket> dataPackets(MAX_HISTORY_SIZE);
+    CFDP::Checksum checksum;
+    validatePacketHistory(
+        *this->fromPortHistory_bufferSendOut,
+        dataPackets,
+        Fw::FilePacket::T_CANCEL,
+        FILEDOWNLINK_MAX_WINDOW_SIZE + 1,
+        checksum,
+        0
+    );
+    ASSERT_EQ(FileDownlink::Mode::COOLDOWN, this->component.mode.get());
+
+    this->removeFile(sourceFileName);
+  }
+
+  void Tester ::
+    readAhead()
+  {
+    // Create a file that spans a little over two read-ahead buffers
+    const char *const sourceFileName = "source.bin";
+    const U32 fileSize = 2 * FILEDOWNLINK_READ_AHEAD_SIZE + 333;
+    std::vector<U8> contents(fileSize);
+    for (U32 i = 0; i < fileSize; ++i) {
+      contents[i] = static_cast<U8>(i * 7 + (i >> 8));
+    }
+    Os::File osFile;
+    ASSERT_EQ(Os::File::OP_OK, osFile.open(sourceFileName, Os::File::OPEN_WRITE));
+    NATIVE_INT_TYPE size = static_cast<NATIVE_INT_TYPE>(fileSize);
+    ASSERT_EQ(Os::File::OP_OK, osFile.write(&contents[0], size));
+    ASSERT_EQ(fileSize, static_cast<U32>(size));
+    osFile.close();
+
+    FileDownlink::File& file = this->component.file;
+    ASSERT_EQ(Os::File::OP_OK, file.open(sourceFileName, "dest.bin"));
+    CFDP::Checksum checksum;
+
+    // Read the file sequentially in packet-sized chunks. The buffer is
+    // refilled only when a read runs past its end.
+    const U32 chunkSize = FILEDOWNLINK_INTERNAL_BUFFER_SIZE / 2;
+    U32 fills = 0;
+    U32 lastFillOffset = 0;
+    for (U32 offset = 0; offset < fileSize; offset += chunkSize) {
+      const U32 readSize = (offset + chunkSize > fileSize) ? fileSize - offset : chunkSize;
+      this->readAndCheck(&contents[0], offset, readSize, checksum);
+      if (fills == 0 || file.readAheadOffset != lastFillOffset) {
+        ++fills;
+        lastFillOffset = file.readAheadOffset;
+      }
+    }
+    ASSERT_EQ(3U, fills);
+
+    // Jump back as a partial downlink would; the buffer is refilled there
+    this->readAndCheck(&contents[0], 10, chunkSize, checksum);
+    ASSERT_EQ(10U, file.readAheadOffset);
+    ASSERT_EQ(FILEDOWNLINK_READ_AHEAD_SIZE, file.readAheadLength);
+    this->readAndCheck(&contents[0], 10 + chunkSize, chunkSize, checksum);
+    ASSERT_EQ(10U, file.readAheadOffset);
+
+    // A read larger than the buffer bypasses it
+    this->readAndCheck(&contents[0], 3, FILEDOWNLINK_READ_AHEAD_SIZE + 5, checksum);
+    ASSERT_EQ(10U, file.readAheadOffset);
+
+    // The buffer is never filled past the end of the file
+    this->readAndCheck(&contents[0], fileSize - 1, 1, checksum);
+    ASSERT_EQ(fileSize - 1, file.readAheadOffset);
+    ASSERT_EQ(1U, file.readAheadLength);
+
+    file.osFile.close();
+    this->removeFile(sourceFileName);
+  }
+
   // ----------------------------------------------------------------------
   // Handlers for from ports
   // ----------------------------------------------------------------------
@@ -408,7 +579,17 @@ namespace Svc {
     Fw::Buffer buffer_new = buffer;
     buffer_new.setData(data);
     pushFromPortEntry_bufferSendOut(buffer_new);
-    invoke_to_bufferReturn(0, buffer);
+    if (this->returnDelay == 0) {
+      invoke_to_bufferReturn(0, buffer);
+    }
+    else {
+      // Hold the buffer as a link with latency would
+      ASSERT_LT(this->numDelayed, FW_NUM_ARRAY_ELEMENTS(this->delayedBuffers));
+      this->delayedBuffers[this->numDelayed] = buffer;
+      this->delayedReturnCycles[this->numDelayed] = this->cycle + this->returnDelay;
+      ++this->numDelayed;
+      this->maxDelayed = FW_MAX(this->maxDelayed, this->numDelayed);
+    }
   }
 
    void Tester ::
@@ -609,6 +790,85 @@ namespace Svc {
     }
   }
 
+  void Tester ::
+    readAndCheck(
+        const U8 *const contents,
+        const U32 byteOffset,
+        const U32 size,
+        CFDP::Checksum& checksum
+    )
+  {
+    std::vector<U8> data(size);
+    const Os::File::Status status = this->component.file.read(&data[0], byteOffset, size);
+    ASSERT_EQ(Os::File::OP_OK, status);
+    ASSERT_EQ(0, ::memcmp(&data[0], &contents[byteOffset], size)) <<
+      "offset " << byteOffset << " size " << size;
+    checksum.update(&contents[byteOffset], byteOffset, size);
+    CFDP::Checksum actual;
+    this->component.file.getChecksum(actual);
+    ASSERT_EQ(checksum, actual);
+  }
+
+  void Tester ::
+    runDelayedCycle()
+  {
+    this->component.Run_handler(0,0);
+    ++this->cycle;
+    // Return the buffers that are due, oldest first
+    U32 numReturned = 0;
+    while (numReturned < this->numDelayed &&
+        this->delayedReturnCycles[numReturned] <= this->cycle) {
+      invoke_to_bufferReturn(0, this->delayedBuffers[numReturned]);
+      ++numReturned;
+    }
+    this->numDelayed -= numReturned;
+    for (U32 i = 0; i < this->numDelayed; ++i) {
+      this->delayedBuffers[i] = this->delayedBuffers[i + numReturned];
+      this->delayedReturnCycles[i] = this->delayedReturnCycles[i + numReturned];
+    }
+    // Handle the returns, which may send more packets
+    while (this->component.m_queue.getNumMsgs() > 0) {
+      this->component.doDispatch();
+    }
+  }
+
+  void Tester ::
+    sendFileDelayed(
+        const char *const sourceFileName,
+        const char *const destFileName,
+        U32& cycles
+    )
+  {
+    Fw::CmdStringArg sourceCmdStringArg(sourceFileName);
+    Fw::CmdStringArg destCmdStringArg(destFileName);
+    this->sendCmd_SendFile(
+        INSTANCE,
+        CMD_SEQ,
+        sourceCmdStringArg,
+        destCmdStringArg
+    );
+    this->component.doDispatch();
+
+    this->returnDelay = RETURN_DELAY_CYCLES;
+    this->maxDelayed = 0;
+    // The first cycle starts the file
+    cycles = 0;
+    while (this->cmdResponseHistory->size() == 0) {
+      this->runDelayedCycle();
+      ++cycles;
+    }
+    this->returnDelay = 0;
+
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, FileDownlink::OPCODE_SENDFILE, CMD_SEQ, Fw::CmdResponse::OK);
+    ASSERT_EQ(0U, this->numDelayed);
+
+    // Wait out the cooldown
+    while (this->component.mode.get() != FileDownlink::Mode::IDLE) {
+      this->component.Run_handler(0,0);
+    }
+  }
+
   // ----------------------------------------------------------------------
   // Private static methods
   // ----------------------------------------------------------------------
@@ -18,7 +18,7 @@
 #include "GTestBase.hpp"
 
 #define MAX_HISTORY_SIZE 10
-#define FILE_BUFFER_CAPACITY 100
+#define FILE_BUFFER_CAPACITY 1000
 
 namespace Svc {
 
@@ -135,6 +135,23 @@ namespace Svc {
       //!
       void sendFilePort();
 
+      //! Downlink a file over a link that returns buffers late,
+      //! first waiting for each packet and then with a full window
+      //! Verify that the window sends the same packets in fewer cycles
+      //!
+      void downlinkWindow();
+
+      //! Cancel a downlink while a full window of packets is out
+      //!
+      void cancelWindow();
+
+      //! Read a file larger than the read-ahead buffer sequentially,
+      //! with jumps, and with a read larger than the buffer
+      //! Verify the data and checksum and that the buffer is refilled
+      //! only when a read falls outside it
+      //!
+      void readAhead();
+
     private:
 
       // ----------------------------------------------------------------------
@@ -209,6 +226,31 @@ namespace Svc {
           const char *const name //!< The file name
       );
 
+      //! Run the component for one cycle, then return the buffers
+      //! sent returnDelay cycles ago and dispatch the returns
+      //!
+      void runDelayedCycle();
+
+      //! Command the FileDownlink component to send a file, returning
+      //! each buffer returnDelay cycles after it is sent
+      //! Assert a command response
+      //!
+      void sendFileDelayed(
+          const char *const sourceFileName, //!< The source file name
+          const char *const destFileName, //!< The destination file name
+          U32& cycles //!< The number of cycles until the command response
+      );
+
+      //! Read bytes through the component file and check them
+      //! against the file contents
+      //!
+      void readAndCheck(
+          const U8 *const contents, //!< The file contents
+          const U32 byteOffset, //!< The offset to read at
+          const U32 size, //!< The number of bytes to read
+          CFDP::Checksum& checksum //!< The expected checksum, updated
+      );
+
       // ----------------------------------------------------------------------
       // Private static methods
       // ----------------------------------------------------------------------
@@ -283,6 +325,31 @@ namespace Svc {
       //! The current sequence index
       //!
       U32 sequenceIndex;
+
+      //! Number of Run cycles before a sent buffer is returned;
+      //! zero returns it as soon as it is sent
+      //!
+      U32 returnDelay;
+
+      //! The current Run cycle
+      //!
+      U32 cycle;
+
+      //! Buffers waiting to be returned, oldest first
+      //!
+      Fw::Buffer delayedBuffers[FILEDOWNLINK_MAX_WINDOW_SIZE];
+
+      //! The cycle at which each waiting buffer is returned
+      //!
+      U32 delayedReturnCycles[FILEDOWNLINK_MAX_WINDOW_SIZE];
+
+      //! Number of buffers waiting to be returned
+      //!
+      U32 numDelayed;
+
+      //! Most buffers waiting to be returned at once in sendFileDelayed
+      //!
+      U32 maxDelayed;
   };
 
 } // end namespace Svc
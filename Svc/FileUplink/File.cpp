@@ -13,6 +13,7 @@
 #include <Svc/FileUplink/FileUplink.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Types/StringUtils.hpp>
+#include <cstring>
 
 namespace Svc {
 
@@ -28,6 +29,8 @@ namespace Svc {
     this->size = startPacket.fileSize;
     CFDP::Checksum checksum;
     this->checksum = checksum;
+    this->writeBackLength = 0;
+    this->numRanges = 0;
     return this->osFile.open(path, Os::File::OPEN_WRITE);
   }
 
@@ -39,6 +42,104 @@ namespace Svc {
     )
   {
 
+    if (!this->osFile.isOpen()) {
+        return Os::File::NOT_OPENED;
+    }
+
+    Os::File::Status status;
+    if (
+        this->writeBackLength > 0 &&
+        byteOffset == this->writeBackOffset + this->writeBackLength &&
+        length <= FILEUPLINK_WRITE_BUFFER_SIZE - this->writeBackLength
+    ) {
+        // Continue the buffered run
+        (void) memcpy(&this->writeBack[this->writeBackLength], data, length);
+        this->writeBackLength += length;
+    }
+    else {
+        status = this->flush();
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+        if (length >= FILEUPLINK_WRITE_BUFFER_SIZE) {
+            // Too large to buffer, so write it directly
+            status = this->writeOsFile(data, byteOffset, length);
+            if (status != Os::File::OP_OK) {
+                return status;
+            }
+        }
+        else {
+            // Start a new buffered run
+            (void) memcpy(this->writeBack, data, length);
+            this->writeBackOffset = byteOffset;
+            this->writeBackLength = length;
+        }
+    }
+
+    this->checksum.update(data, byteOffset, length);
+    return Os::File::OP_OK;
+
+  }
+
+  Os::File::Status FileUplink::File ::
+    flush()
+  {
+    if (this->writeBackLength == 0) {
+        return Os::File::OP_OK;
+    }
+    const U32 length = this->writeBackLength;
+    this->writeBackLength = 0;
+    return this->writeOsFile(this->writeBack, this->writeBackOffset, length);
+  }
+
+  Os::File::Status FileUplink::File ::
+    close()
+  {
+    Os::File::Status status = Os::File::OP_OK;
+    if (this->osFile.isOpen()) {
+        status = this->flush();
+    }
+    this->writeBackLength = 0;
+    this->osFile.close();
+    return status;
+  }
+
+  bool FileUplink::File ::
+    getMissingRange(
+        const U32 index,
+        U32& byteOffset,
+        U32& length
+    ) const
+  {
+    // The missing ranges are the holes before, between, and after
+    // the written ranges
+    U32 count = 0;
+    U32 start = 0;
+    for (U32 i = 0; i <= this->numRanges; ++i) {
+        const U32 end = (i < this->numRanges) ? this->ranges[i].start : this->size;
+        if (end > start) {
+            if (count == index) {
+                byteOffset = start;
+                length = end - start;
+                return true;
+            }
+            ++count;
+        }
+        if (i < this->numRanges) {
+            start = this->ranges[i].end;
+        }
+    }
+    return false;
+  }
+
+  Os::File::Status FileUplink::File ::
+    writeOsFile(
+        const U8 *const data,
+        const U32 byteOffset,
+        const U32 length
+    )
+  {
+
     Os::File::Status status;
     status = this->osFile.seek(byteOffset);
     if (status != Os::File::OP_OK) {
@@ -53,9 +154,64 @@ namespace Svc {
     }
 
     FW_ASSERT(static_cast<U32>(intLength) == length, intLength);
-    this->checksum.update(data, byteOffset, length);
+    this->recordRange(byteOffset, length);
     return Os::File::OP_OK;
 
   }
 
+  void FileUplink::File ::
+    recordRange(
+        const U32 byteOffset,
+        const U32 length
+    )
+  {
+    if (length == 0) {
+        return;
+    }
+    U32 start = byteOffset;
+    U32 end = byteOffset + length;
+
+    // Find the first range that ends at or after the new one starts
+    U32 first = 0;
+    while (first < this->numRanges && this->ranges[first].end < start) {
+        ++first;
+    }
+
+    // Merge the ranges that overlap or touch the new one
+    U32 last = first;
+    while (last < this->numRanges && this->ranges[last].start <= end) {
+        if (this->ranges[last].start < start) {
+            start = this->ranges[last].start;
+        }
+        if (this->ranges[last].end > end) {
+            end = this->ranges[last].end;
+        }
+        ++last;
+    }
+
+    if (last > first) {
+        // Replace the merged ranges with one range
+        this->ranges[first].start = start;
+        this->ranges[first].end = end;
+        (void) memmove(
+            &this->ranges[first + 1],
+            &this->ranges[last],
+            (this->numRanges - last) * sizeof(Range)
+        );
+        this->numRanges -= last - first - 1;
+    }
+    else if (this->numRanges < FILEUPLINK_MAX_RECEIVED_RANGES) {
+        // Insert a new range
+        (void) memmove(
+            &this->ranges[first + 1],
+            &this->ranges[first],
+            (this->numRanges - first) * sizeof(Range)
+        );
+        this->ranges[first].start = start;
+        this->ranges[first].end = end;
+        ++this->numRanges;
+    }
+    // Otherwise there is no room, and these bytes will be reported missing
+  }
+
 }
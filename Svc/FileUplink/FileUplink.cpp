@@ -108,7 +108,7 @@ namespace Svc {
     this->log_WARNING_HI_PacketOutOfOrder_ThrottleClear();
     this->packetsReceived.packetReceived();
     if (this->receiveMode != START) {
-      this->file.osFile.close();
+      (void) this->file.close();
       this->warnings.invalidReceiveMode(Fw::FilePacket::T_START);
     }
     const Os::File::Status status = this->file.open(startPacket);
@@ -154,7 +154,12 @@ namespace Svc {
     if (this->receiveMode == DATA) {
       this->filesReceived.fileReceived();
       this->checkSequenceIndex(endPacket.header.sequenceIndex);
+      const Os::File::Status status = this->file.flush();
+      if (status != Os::File::OP_OK) {
+        this->warnings.fileWrite(this->file.name);
+      }
       this->compareChecksums(endPacket);
+      this->checkMissingRanges();
       this->log_ACTIVITY_HI_FileReceived(this->file.name);
     }
     else {
@@ -197,10 +202,25 @@ namespace Svc {
     }
   }
 
+  void FileUplink ::
+    checkMissingRanges()
+  {
+    U32 byteOffset = 0;
+    U32 length = 0;
+    if (this->file.getMissingRange(0, byteOffset, length)) {
+      U32 numRanges = 1;
+      U32 nextOffset, nextLength;
+      while (this->file.getMissingRange(numRanges, nextOffset, nextLength)) {
+        ++numRanges;
+      }
+      this->warnings.fileIncomplete(numRanges, byteOffset, length);
+    }
+  }
+
   void FileUplink ::
     goToStartMode()
   {
-    this->file.osFile.close();
+    (void) this->file.close();
     this->receiveMode = START;
     this->lastSequenceIndex = 0;
   }
@@ -13,6 +13,7 @@
 #ifndef Svc_FileUplink_HPP
 #define Svc_FileUplink_HPP
 
+#include <FileUplinkCfg.hpp>
 #include <Svc/FileUplink/FileUplinkComponentAc.hpp>
 #include <Fw/FilePacket/FilePacket.hpp>
 #include <Os/File.hpp>
@@ -35,6 +36,24 @@ namespace Svc {
       //! An object representing an incoming file
       class File {
 
+        PRIVATE:
+
+          //! A range of bytes written to the OS file
+          struct Range {
+            U32 start; //!< The offset of the first byte
+            U32 end; //!< The offset one past the last byte
+          };
+
+        public:
+
+          //! Constructor
+          File() :
+            size(0),
+            writeBackOffset(0),
+            writeBackLength(0),
+            numRanges(0)
+          { }
+
         public:
 
           //! The file size
@@ -51,6 +70,36 @@ namespace Svc {
           //! The checksum for the file
           ::CFDP::Checksum checksum;
 
+          //! The file offset of the first byte in the write-back buffer
+          U32 writeBackOffset;
+
+          //! The number of bytes in the write-back buffer
+          U32 writeBackLength;
+
+          //! The write-back buffer
+          U8 writeBack[FILEUPLINK_WRITE_BUFFER_SIZE];
+
+          //! The byte ranges written to the OS file, sorted and disjoint
+          Range ranges[FILEUPLINK_MAX_RECEIVED_RANGES];
+
+          //! The number of valid entries in ranges
+          U32 numRanges;
+
+        PRIVATE:
+
+          //! Write bytes to the OS file at an offset and record the range
+          Os::File::Status writeOsFile(
+              const U8 *const data,
+              const U32 byteOffset,
+              const U32 length
+          );
+
+          //! Record a range of bytes written to the OS file
+          void recordRange(
+              const U32 byteOffset,
+              const U32 length
+          );
+
         public:
 
           //! Open the OS file for writing and initialize the checksum
@@ -58,13 +107,30 @@ namespace Svc {
               const Fw::FilePacket::StartPacket& startPacket
           );
 
-          //! Write bytes into the OS file and update the checksum
+          //! Write bytes into the file and update the checksum
+          //! Bytes that continue the buffered run are held in the
+          //! write-back buffer until the next flush
           Os::File::Status write(
               const U8 *const data,
               const U32 byteOffset,
               const U32 length
           );
 
+          //! Write the buffered bytes to the OS file
+          Os::File::Status flush();
+
+          //! Flush the buffered bytes and close the OS file
+          Os::File::Status close();
+
+          //! Get a byte range of the file not yet written to the OS file
+          //! Call flush first to include the buffered bytes
+          //! \return Whether a missing range with this index exists
+          bool getMissingRange(
+              const U32 index, //!< The index of the missing range
+              U32& byteOffset, //!< The offset of the range
+              U32& length //!< The length of the range
+          ) const;
+
           //! Get the checksum
           void getChecksum(::CFDP::Checksum& checksum) {
             checksum = this->checksum;
@@ -167,6 +233,13 @@ namespace Svc {
               const U32 read
           );
 
+          //! Record a File Incomplete warning
+          void fileIncomplete(
+              const U32 numRanges,
+              const U32 byteOffset,
+              const U32 length
+          );
+
         PRIVATE:
 
           //! Record a warning
@@ -253,6 +326,9 @@ namespace Svc {
       //! Compare checksums
       void compareChecksums(const Fw::FilePacket::EndPacket& endPacket);
 
+      //! Check that every byte of the file was written
+      void checkMissingRanges();
+
       //! Go to START mode
       void goToStartMode();
 
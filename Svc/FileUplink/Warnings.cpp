@@ -78,4 +78,20 @@ namespace Svc {
     this->warning();
   }
 
+  void FileUplink::Warnings ::
+    fileIncomplete(
+        const U32 numRanges,
+        const U32 byteOffset,
+        const U32 length
+    )
+  {
+    this->fileUplink->log_WARNING_HI_FileIncomplete(
+        this->fileUplink->file.name,
+        numRanges,
+        byteOffset,
+        length
+    );
+    this->warning();
+  }
+
 }
@@ -59,6 +59,21 @@ TEST(FileUplink, CancelPacketInDataMode) {
   tester.cancelPacketInDataMode();
 }
 
+TEST(FileUplink, DataOutOfByteOrder) {
+  Svc::Tester tester;
+  tester.dataOutOfByteOrder();
+}
+
+TEST(FileUplink, MissingData) {
+  Svc::Tester tester;
+  tester.missingData();
+}
+
+TEST(FileUplink, ReceivedRanges) {
+  Svc::Tester tester;
+  tester.receivedRanges();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
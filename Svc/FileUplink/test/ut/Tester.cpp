@@ -460,6 +460,159 @@ namespace Svc {
 
   }
 
+  void Tester ::
+    dataOutOfByteOrder()
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    const U32 numPackets = 4;
+    U8 packetData[numPackets][PACKET_SIZE] = {
+      { 0, 1, 2, 3, 4 },
+      { 5, 6, 7, 8, 9 },
+      { 10, 11, 12, 13, 14 },
+      { 15, 16, 17, 18, 19 }
+    };
+    const U8 *const linearPacketData = reinterpret_cast<U8*>(packetData);
+    const size_t fileSize = sizeof(packetData);
+    FileUplink::File& file = this->component.file;
+
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+
+    // Contiguous packets are held in the write-back buffer
+    this->sendDataPacket(0, packetData[0]);
+    this->sendDataPacket(PACKET_SIZE, packetData[1]);
+    ASSERT_EQ(0U, file.writeBackOffset);
+    ASSERT_EQ(2U * PACKET_SIZE, file.writeBackLength);
+    ASSERT_EQ(0U, file.numRanges);
+
+    // A packet that skips ahead writes the buffered run
+    this->sendDataPacket(3 * PACKET_SIZE, packetData[3]);
+    ASSERT_EQ(3U * PACKET_SIZE, file.writeBackOffset);
+    ASSERT_EQ(1U, file.numRanges);
+
+    // The packet that fills the hole arrives last
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[2]);
+    ASSERT_EQ(2U, file.numRanges);
+    ASSERT_EQ(0U, file.ranges[0].start);
+    ASSERT_EQ(2U * PACKET_SIZE, file.ranges[0].end);
+    ASSERT_EQ(3U * PACKET_SIZE, file.ranges[1].start);
+    ASSERT_EQ(4U * PACKET_SIZE, file.ranges[1].end);
+    ASSERT_EVENTS_SIZE(0);
+
+    // The end packet flushes the buffer and the file is complete
+    CFDP::Checksum checksum;
+    checksum.update(linearPacketData, 0, fileSize);
+    this->sendEndPacket(checksum);
+    ASSERT_EQ(1U, file.numRanges);
+    ASSERT_EQ(0U, file.ranges[0].start);
+    ASSERT_EQ(fileSize, file.ranges[0].end);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+    ASSERT_EQ(FileUplink::START, this->component.receiveMode);
+
+    this->verifyFileData(destPath, linearPacketData, fileSize);
+    this->removeFile(destPath);
+
+  }
+
+  void Tester ::
+    missingData()
+  {
+
+    const char *const sourcePath = "source.bin";
+    const char *const destPath = "dest.bin";
+    U8 packetData[2][PACKET_SIZE] = {
+      { 0, 1, 2, 3, 4 },
+      { 10, 11, 12, 13, 14 }
+    };
+    const size_t fileSize = 4 * PACKET_SIZE;
+
+    // Send the first and third of four packets
+    this->sendStartPacket(sourcePath, destPath, fileSize);
+    this->sendDataPacket(0, packetData[0]);
+    this->sendDataPacket(2 * PACKET_SIZE, packetData[1]);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Send the end packet with the checksum of the data sent
+    CFDP::Checksum checksum;
+    checksum.update(packetData[0], 0, PACKET_SIZE);
+    checksum.update(packetData[1], 2 * PACKET_SIZE, PACKET_SIZE);
+    this->sendEndPacket(checksum);
+
+    ASSERT_TLM_SIZE(3);
+    ASSERT_TLM_FilesReceived(0, 1);
+    ASSERT_TLM_Warnings(0, 1);
+    ASSERT_EVENTS_SIZE(2);
+    ASSERT_EVENTS_FileIncomplete_SIZE(1);
+    ASSERT_EVENTS_FileIncomplete(0, destPath, 2, PACKET_SIZE, PACKET_SIZE);
+    ASSERT_EVENTS_FileReceived(0, destPath);
+
+    // Both missing ranges are available for retransmission
+    U32 byteOffset = 0;
+    U32 length = 0;
+    const FileUplink::File& file = this->component.file;
+    ASSERT_TRUE(file.getMissingRange(0, byteOffset, length));
+    ASSERT_EQ(static_cast<U32>(PACKET_SIZE), byteOffset);
+    ASSERT_EQ(static_cast<U32>(PACKET_SIZE), length);
+    ASSERT_TRUE(file.getMissingRange(1, byteOffset, length));
+    ASSERT_EQ(3U * PACKET_SIZE, byteOffset);
+    ASSERT_EQ(static_cast<U32>(PACKET_SIZE), length);
+    ASSERT_FALSE(file.getMissingRange(2, byteOffset, length));
+
+    this->removeFile(destPath);
+
+  }
+
+  void Tester ::
+    receivedRanges()
+  {
+
+    FileUplink::File& file = this->component.file;
+    const U32 rangeSize = 10;
+    file.size = 2 * rangeSize * (FILEUPLINK_MAX_RECEIVED_RANGES + 1);
+    file.numRanges = 0;
+
+    // Fill the table with disjoint ranges, in reverse order
+    for (U32 i = FILEUPLINK_MAX_RECEIVED_RANGES; i > 0; --i) {
+      file.recordRange(2 * rangeSize * i, rangeSize);
+    }
+    ASSERT_EQ(FILEUPLINK_MAX_RECEIVED_RANGES, file.numRanges);
+    for (U32 i = 0; i < file.numRanges; ++i) {
+      ASSERT_EQ(2 * rangeSize * (i + 1), file.ranges[i].start);
+      ASSERT_EQ(2 * rangeSize * (i + 1) + rangeSize, file.ranges[i].end);
+    }
+
+    // A further disjoint range is not recorded, so it stays missing
+    file.recordRange(0, rangeSize);
+    ASSERT_EQ(FILEUPLINK_MAX_RECEIVED_RANGES, file.numRanges);
+    U32 byteOffset = 0;
+    U32 length = 0;
+    ASSERT_TRUE(file.getMissingRange(0, byteOffset, length));
+    ASSERT_EQ(0U, byteOffset);
+    ASSERT_EQ(2 * rangeSize, length);
+
+    // A range that touches its neighbors on both sides merges them
+    file.recordRange(3 * rangeSize, rangeSize);
+    ASSERT_EQ(FILEUPLINK_MAX_RECEIVED_RANGES - 1, file.numRanges);
+    ASSERT_EQ(2 * rangeSize, file.ranges[0].start);
+    ASSERT_EQ(5 * rangeSize, file.ranges[0].end);
+
+    // A range that overlaps several ranges merges them
+    file.recordRange(file.ranges[1].start + 1, 4 * rangeSize);
+    ASSERT_EQ(FILEUPLINK_MAX_RECEIVED_RANGES - 3, file.numRanges);
+    ASSERT_EQ(6 * rangeSize, file.ranges[1].start);
+    ASSERT_EQ(11 * rangeSize, file.ranges[1].end);
+
+    // Now there is room to record the first range
+    file.recordRange(0, rangeSize);
+    ASSERT_EQ(FILEUPLINK_MAX_RECEIVED_RANGES - 2, file.numRanges);
+    ASSERT_TRUE(file.getMissingRange(0, byteOffset, length));
+    ASSERT_EQ(rangeSize, byteOffset);
+    ASSERT_EQ(rangeSize, length);
+
+  }
+
   // ----------------------------------------------------------------------
   // Handlers for from ports
   // ----------------------------------------------------------------------
@@ -88,6 +88,21 @@ namespace Svc {
       //!
       void cancelPacketInDataMode();
 
+      //! Send a file with data packets out of byte order
+      //! Verify that contiguous packets are written together
+      //! and that the file is complete
+      //!
+      void dataOutOfByteOrder();
+
+      //! Send a file with a data packet missing
+      //!
+      void missingData();
+
+      //! Record received ranges that touch, overlap, and overflow
+      //! the range table
+      //!
+      void receivedRanges();
+
     private:
 
       // ----------------------------------------------------------------------
@@ -62,6 +62,25 @@ void FramerComponentImpl ::send(Fw::Buffer& outgoing) {
     }
 }
 
+bool FramerComponentImpl ::sendGather(const U8* const header, const U32 header_size,
+                                      const U8* const data, const U32 data_size,
+                                      const U8* const trailer, const U32 trailer_size) {
+    if (not isConnected_framedGatherOut_OutputPort(0)) {
+        return false;
+    }
+    // The driver only reads the parts during the call and does not take ownership of them
+    Fw::Buffer headerBuffer(const_cast<U8*>(header), header_size);
+    Fw::Buffer dataBuffer(const_cast<U8*>(data), data_size);
+    Fw::Buffer trailerBuffer(const_cast<U8*>(trailer), trailer_size);
+    Drv::SendStatus sendStatus = framedGatherOut_out(0, headerBuffer, dataBuffer, trailerBuffer);
+    if (sendStatus.e != Drv::SendStatus::SEND_OK) {
+        // Note: if there is a data sending problem, an EVR likely wouldn't make it down. Log the issue in hopes that
+        // someone will see it.
+        Fw::Logger::logMsg("[ERROR] Failed to send framed data: %d\n", sendStatus.e);
+    }
+    return true;
+}
+
 Fw::Buffer FramerComponentImpl ::allocate(const U32 size) {
     this->getTime();
     return framedAllocate_out(0, size);
@@ -62,6 +62,16 @@ class FramerComponentImpl : public FramerComponentBase, public FramingProtocolIn
     //! \return Fw::Buffer containing allocation to write into
     Fw::Buffer allocate(const U32 size);
 
+    //! \brief Gathered send callback used to send a frame without assembling it
+    //!
+    //! Sends the header, data and trailer out the framedGatherOut port when it is connected. The data is sent where
+    //! it lies, so no framed buffer is allocated and the data is not copied.
+    //!
+    //! \return true if framedGatherOut is connected and the frame was sent, false otherwise
+    bool sendGather(const U8* const header, const U32 header_size,
+                    const U8* const data, const U32 data_size,
+                    const U8* const trailer, const U32 trailer_size);
+
   PRIVATE:
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined typed input ports
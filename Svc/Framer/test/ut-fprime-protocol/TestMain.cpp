@@ -0,0 +1,40 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "Tester.hpp"
+
+TEST(Assembled, Com) {
+    Svc::Tester tester(false);
+    tester.test_com();
+}
+
+TEST(Assembled, File) {
+    Svc::Tester tester(false);
+    tester.test_file();
+}
+
+TEST(Gathered, Com) {
+    Svc::Tester tester(true);
+    tester.test_com();
+}
+
+TEST(Gathered, File) {
+    Svc::Tester tester(true);
+    tester.test_file();
+}
+
+TEST(Assembled, CopyCount) {
+    Svc::Tester tester(false);
+    tester.test_copy_count(100);
+}
+
+TEST(Gathered, CopyCount) {
+    Svc::Tester tester(true);
+    tester.test_copy_count(100);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
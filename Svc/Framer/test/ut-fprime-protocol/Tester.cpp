@@ -0,0 +1,197 @@
+// ======================================================================
+// \title  Framer/test/ut-fprime-protocol/Tester.cpp
+// \brief  Implementation file for Framer test with F Prime protocol
+//
+// \copyright
+// Copyright 2009-2022, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Tester.hpp"
+
+#include <cstring>
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 10
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+Tester ::Tester(const bool gather)
+    : FramerGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("Framer"),
+      m_gather(gather),
+      m_record(true),
+      m_frameSize(0),
+      m_payload(nullptr),
+      m_bytesCopied(0),
+      m_allocations(0) {
+    this->initComponents();
+    this->connectPorts();
+    component.setup(this->m_framing);
+}
+
+Tester ::~Tester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void Tester ::test_com() {
+    Fw::ComBuffer com;
+    for (U32 i = 0; i < 100; i++) {
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, com.serialize(static_cast<U8>(i)));
+    }
+    invoke_to_comIn(0, com, 0);
+    ASSERT_from_framedOut_SIZE(m_gather ? 0 : 1);
+    ASSERT_from_framedGatherOut_SIZE(m_gather ? 1 : 0);
+    ASSERT_from_framedAllocate_SIZE(m_gather ? 0 : 1);
+    this->check_frame(com.getBuffAddr(), com.getBuffLength(), Fw::ComPacket::FW_PACKET_UNKNOWN);
+    // Gathered frames send the data where it lies
+    ASSERT_EQ(m_gather, m_payload == com.getBuffAddr());
+}
+
+void Tester ::test_file() {
+    U8* data = new U8[FILE_BUFFER_SIZE];
+    for (U32 i = 0; i < FILE_BUFFER_SIZE; i++) {
+        data[i] = static_cast<U8>(i * 7);
+    }
+    Fw::Buffer buffer(data, FILE_BUFFER_SIZE);
+    invoke_to_bufferIn(0, buffer);
+    ASSERT_from_framedOut_SIZE(m_gather ? 0 : 1);
+    ASSERT_from_framedGatherOut_SIZE(m_gather ? 1 : 0);
+    ASSERT_from_framedAllocate_SIZE(m_gather ? 0 : 1);
+    ASSERT_from_bufferDeallocate_SIZE(1);
+    ASSERT_from_bufferDeallocate(0, buffer);
+    this->check_frame(data, FILE_BUFFER_SIZE, Fw::ComPacket::FW_PACKET_FILE);
+    ASSERT_EQ(m_gather, m_payload == data);
+    delete[] data;
+}
+
+void Tester ::test_copy_count(const U32 iterations) {
+    U8* data = new U8[FILE_BUFFER_SIZE];
+    ::memset(data, 0xA5, FILE_BUFFER_SIZE);
+    m_record = false;
+    m_bytesCopied = 0;
+    m_allocations = 0;
+    for (U32 i = 0; i < iterations; i++) {
+        Fw::Buffer buffer(data, FILE_BUFFER_SIZE);
+        invoke_to_bufferIn(0, buffer);
+        this->clearHistory();
+    }
+    // Assembled frames allocate one framed buffer each and copy the whole frame into it, gathered frames do neither
+    ASSERT_EQ(m_gather ? 0U : iterations, m_allocations);
+    ASSERT_EQ(m_gather ? 0U : static_cast<U64>(iterations) * MAX_FRAME_SIZE, m_bytesCopied);
+    m_record = true;
+    delete[] data;
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+void Tester ::from_bufferDeallocate_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    this->pushFromPortEntry_bufferDeallocate(fwBuffer);
+}
+
+Fw::Buffer Tester ::from_framedAllocate_handler(const NATIVE_INT_TYPE portNum, U32 size) {
+    this->pushFromPortEntry_framedAllocate(size);
+    m_allocations++;
+    Fw::Buffer buffer(new U8[size], size);
+    return buffer;
+}
+
+Drv::SendStatus Tester ::from_framedOut_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& sendBuffer) {
+    this->pushFromPortEntry_framedOut(sendBuffer);
+    // The whole frame was copied into the allocated buffer
+    m_bytesCopied += sendBuffer.getSize();
+    if (m_record) {
+        FW_ASSERT(sendBuffer.getSize() <= sizeof(m_frame), sendBuffer.getSize());
+        ::memcpy(m_frame, sendBuffer.getData(), sendBuffer.getSize());
+        m_frameSize = sendBuffer.getSize();
+        m_payload = sendBuffer.getData() + FpFrameHeader::SIZE;
+    }
+    delete[] sendBuffer.getData();
+    return Drv::SendStatus::SEND_OK;
+}
+
+Drv::SendStatus Tester ::from_framedGatherOut_handler(const NATIVE_INT_TYPE portNum,
+                                                      Fw::Buffer& header,
+                                                      Fw::Buffer& payload,
+                                                      Fw::Buffer& trailer) {
+    this->pushFromPortEntry_framedGatherOut(header, payload, trailer);
+    if (m_record) {
+        FW_ASSERT(header.getSize() + payload.getSize() + trailer.getSize() <= sizeof(m_frame));
+        ::memcpy(m_frame, header.getData(), header.getSize());
+        ::memcpy(m_frame + header.getSize(), payload.getData(), payload.getSize());
+        ::memcpy(m_frame + header.getSize() + payload.getSize(), trailer.getData(), trailer.getSize());
+        m_frameSize = header.getSize() + payload.getSize() + trailer.getSize();
+        m_payload = payload.getData();
+    }
+    return Drv::SendStatus::SEND_OK;
+}
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+void Tester ::check_frame(const U8* const data, const U32 size, const Fw::ComPacket::ComPacketType packet_type) {
+    const U32 typeSize = (packet_type != Fw::ComPacket::FW_PACKET_UNKNOWN) ? sizeof(I32) : 0;
+    ASSERT_EQ(FpFrameHeader::SIZE + typeSize + size + HASH_DIGEST_LENGTH, m_frameSize);
+    // Header: start word then the size of the packet type and data
+    Fw::ExternalSerializeBuffer serializer(m_frame, m_frameSize);
+    serializer.setBuffLen(m_frameSize);
+    FpFrameHeader::TokenType start = 0;
+    FpFrameHeader::TokenType packetSize = 0;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, serializer.deserialize(start));
+    ASSERT_EQ(FpFrameHeader::START_WORD, start);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, serializer.deserialize(packetSize));
+    ASSERT_EQ(typeSize + size, packetSize);
+    if (typeSize > 0) {
+        I32 type = 0;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, serializer.deserialize(type));
+        ASSERT_EQ(static_cast<I32>(packet_type), type);
+    }
+    // Data follows unchanged, then the hash of everything before it
+    ASSERT_EQ(0, ::memcmp(m_frame + FpFrameHeader::SIZE + typeSize, data, size));
+    Utils::HashBuffer hash;
+    Utils::Hash::hash(m_frame, m_frameSize - HASH_DIGEST_LENGTH, hash);
+    ASSERT_EQ(0, ::memcmp(m_frame + m_frameSize - HASH_DIGEST_LENGTH, hash.getBuffAddr(), HASH_DIGEST_LENGTH));
+}
+
+void Tester ::connectPorts() {
+    // comIn
+    this->connect_to_comIn(0, this->component.get_comIn_InputPort(0));
+
+    // bufferIn
+    this->connect_to_bufferIn(0, this->component.get_bufferIn_InputPort(0));
+
+    // bufferDeallocate
+    this->component.set_bufferDeallocate_OutputPort(0, this->get_from_bufferDeallocate(0));
+
+    // framedAllocate
+    this->component.set_framedAllocate_OutputPort(0, this->get_from_framedAllocate(0));
+
+    // framedOut
+    this->component.set_framedOut_OutputPort(0, this->get_from_framedOut(0));
+
+    // framedGatherOut
+    if (m_gather) {
+        this->component.set_framedGatherOut_OutputPort(0, this->get_from_framedGatherOut(0));
+    }
+
+    // timeGet
+    this->component.set_timeGet_OutputPort(0, this->get_from_timeGet(0));
+}
+
+void Tester ::initComponents() {
+    this->init();
+    this->component.init(INSTANCE);
+}
+
+}  // end namespace Svc
@@ -0,0 +1,125 @@
+// ======================================================================
+// \title  Framer/test/ut-fprime-protocol/Tester.hpp
+// \brief  Header file for Framer test with F Prime protocol
+//
+// \copyright
+// Copyright 2009-2022, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef SVC_TESTER_HPP
+#define SVC_TESTER_HPP
+
+#include "Fw/Com/ComBuffer.hpp"
+#include "Fw/Com/ComPacket.hpp"
+#include "GTestBase.hpp"
+#include "Svc/Framer/FramerComponentImpl.hpp"
+#include "Svc/FramingProtocol/FprimeProtocol.hpp"
+#include "Utils/Hash/Hash.hpp"
+
+namespace Svc {
+
+class Tester : public FramerGTestBase {
+  public:
+    //! Enumerated constants
+    enum Constants {
+        //! Size of the file buffers framed, as sent by FileDownlink
+        FILE_BUFFER_SIZE = 3412,
+        //! The largest frame produced by the tests
+        MAX_FRAME_SIZE = FILE_BUFFER_SIZE + FpFrameHeader::SIZE + sizeof(I32) + HASH_DIGEST_LENGTH,
+    };
+
+    //! Construct object Tester
+    //!
+    Tester(const bool gather /*!< Connect the framedGatherOut port*/
+    );
+
+    //! Destroy object Tester
+    //!
+    ~Tester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Frame a com buffer and check the frame sent
+    //!
+    void test_com();
+
+    //! Frame a file buffer and check the frame sent and the buffer returned
+    //!
+    void test_file();
+
+    //! Frame many file buffers and check the framed buffers allocated and the bytes copied into them
+    //!
+    void test_copy_count(const U32 iterations);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for from_bufferDeallocate
+    //!
+    void from_bufferDeallocate_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                       Fw::Buffer& fwBuffer);
+
+    //! Handler for from_framedAllocate
+    //!
+    Fw::Buffer from_framedAllocate_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                           U32 size);
+
+    //! Handler for from_framedOut
+    //!
+    Drv::SendStatus from_framedOut_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                           Fw::Buffer& sendBuffer);
+
+    //! Handler for from_framedGatherOut
+    //!
+    Drv::SendStatus from_framedGatherOut_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                                 Fw::Buffer& header,
+                                                 Fw::Buffer& payload,
+                                                 Fw::Buffer& trailer);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    //! Check the last frame sent against the expected framing of the data
+    //!
+    void check_frame(const U8* const data, const U32 size, const Fw::ComPacket::ComPacketType packet_type);
+
+    //! Connect ports
+    //!
+    void connectPorts();
+
+    //! Initialize components
+    //!
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    //!
+    FramerComponentImpl component;
+
+    FprimeFraming m_framing; //!< The framing protocol under test
+    const bool m_gather; //!< Is framedGatherOut connected
+    bool m_record; //!< Record each frame sent so it can be checked
+    U8 m_frame[MAX_FRAME_SIZE]; //!< The last frame sent
+    U32 m_frameSize; //!< Size of the last frame sent
+    const U8* m_payload; //!< Payload address of the last frame sent
+    U64 m_bytesCopied; //!< Bytes of data copied into framed buffers
+    U32 m_allocations; //!< Framed buffers allocated
+};
+
+}  // end namespace Svc
+
+#endif
@@ -105,6 +105,15 @@ Drv::SendStatus Tester ::from_framedOut_handler(const NATIVE_INT_TYPE portNum, F
     return Drv::SendStatus::SEND_OK;
 }
 
+Drv::SendStatus Tester ::from_framedGatherOut_handler(const NATIVE_INT_TYPE portNum,
+                                                      Fw::Buffer& header,
+                                                      Fw::Buffer& payload,
+                                                      Fw::Buffer& trailer) {
+    // Not connected: the mock framer always allocates and sends an assembled buffer
+    this->pushFromPortEntry_framedGatherOut(header, payload, trailer);
+    return Drv::SendStatus::SEND_OK;
+}
+
 // ----------------------------------------------------------------------
 // Helper methods
 // ----------------------------------------------------------------------
@@ -75,6 +75,13 @@ class Tester : public FramerGTestBase {
     Drv::SendStatus from_framedOut_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
                                            Fw::Buffer& sendBuffer);
 
+    //! Handler for from_framedGatherOut
+    //!
+    Drv::SendStatus from_framedGatherOut_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                                                 Fw::Buffer& header,
+                                                 Fw::Buffer& payload,
+                                                 Fw::Buffer& trailer);
+
   private:
     // ----------------------------------------------------------------------
     // Helper methods
@@ -10,6 +10,7 @@
 //
 // ======================================================================
 
+#include <cstring>
 #include <limits>
 
 #include "FprimeProtocol.hpp"
@@ -27,15 +28,16 @@ void FprimeFraming::frame(const U8* const data, const U32 size, Fw::ComPacket::C
     // Use of I32 size is explicit as ComPacketType will be specifically serialized as an I32
     FpFrameHeader::TokenType real_data_size = size + ((packet_type != Fw::ComPacket::FW_PACKET_UNKNOWN) ? sizeof(I32) : 0);
     FpFrameHeader::TokenType total = real_data_size + FpFrameHeader::SIZE + HASH_DIGEST_LENGTH;
-    Fw::Buffer buffer = m_interface->allocate(total);
-    Fw::SerializeBufferBase& serializer = buffer.getSerializeRepr();
-    Utils::HashBuffer hash;
+    U8 header[FpFrameHeader::SIZE + sizeof(I32)];
+    Fw::ExternalSerializeBuffer serializer(header, sizeof(header));
+    Utils::Hash hash;
+    Utils::HashBuffer hashBuffer;
 
-    // Serialize data
+    // Serialize header
     Fw::SerializeStatus status;
     status = serializer.serialize(FpFrameHeader::START_WORD);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
-    
+
     status = serializer.serialize(real_data_size);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
 
@@ -44,13 +46,29 @@ void FprimeFraming::frame(const U8* const data, const U32 size, Fw::ComPacket::C
         status = serializer.serialize(static_cast<I32>(packet_type)); // I32 used for enum storage
         FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     }
-    
-    status = serializer.serialize(data, size, true);  // Serialize without length
+    const U32 header_size = serializer.getBuffLength();
+
+    // Calculate transmission hash over the header and data where they lie
+    hash.init();
+    hash.update(header, static_cast<NATIVE_INT_TYPE>(header_size));
+    hash.update(data, static_cast<NATIVE_INT_TYPE>(size));
+    hash.final(hashBuffer);
+
+    // Send the parts without copying the data when the interface supports it
+    if (m_interface->sendGather(header, header_size, data, size, hashBuffer.getBuffAddr(), HASH_DIGEST_LENGTH)) {
+        return;
+    }
+
+    // Otherwise assemble the frame in an allocated buffer
+    Fw::Buffer buffer = m_interface->allocate(total);
+    Fw::SerializeBufferBase& frame_serializer = buffer.getSerializeRepr();
+    status = frame_serializer.serialize(header, header_size, true);  // Serialize without length
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+
+    status = frame_serializer.serialize(data, size, true);  // Serialize without length
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
 
-    // Calculate and add transmission hash
-    Utils::Hash::hash(buffer.getData(), total - HASH_DIGEST_LENGTH, hash);
-    status = serializer.serialize(hash.getBuffAddr(), HASH_DIGEST_LENGTH, true);
+    status = frame_serializer.serialize(hashBuffer.getBuffAddr(), HASH_DIGEST_LENGTH, true);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
 
     buffer.setSize(total);
@@ -61,24 +79,24 @@ void FprimeFraming::frame(const U8* const data, const U32 size, Fw::ComPacket::C
 bool FprimeDeframing::validate(Types::CircularBuffer& ring, U32 size) {
     Utils::Hash hash;
     Utils::HashBuffer hashBuffer;
-    // Initialize the checksum and loop through all bytes calculating it
+    const U8* first = nullptr;
+    const U8* second = nullptr;
+    NATIVE_UINT_TYPE firstSize = 0;
+    NATIVE_UINT_TYPE secondSize = 0;
+    // Initialize the checksum and calculate it over the contiguous regions holding the data
     hash.init();
-    for (U32 i = 0; i < size; i++) {
-        char byte;
-        ring.peek(byte, i);
-        hash.update(&byte, 1);
+    Fw::SerializeStatus status = ring.peek_spans(size, 0, first, firstSize, second, secondSize);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    hash.update(first, static_cast<NATIVE_INT_TYPE>(firstSize));
+    if (secondSize > 0) {
+        hash.update(second, static_cast<NATIVE_INT_TYPE>(secondSize));
     }
     hash.final(hashBuffer);
-    // Now loop through the hash digest bytes and check for equality
-    for (U32 i = 0; i < HASH_DIGEST_LENGTH; i++) {
-        char calc = static_cast<char>(hashBuffer.getBuffAddr()[i]);
-        char sent = 0;
-        ring.peek(sent, size + i);
-        if (calc != sent) {
-            return false;
-        }
-    }
-    return true;
+    // Now check the hash digest bytes for equality
+    U8 sent[HASH_DIGEST_LENGTH];
+    status = ring.peek(sent, HASH_DIGEST_LENGTH, size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    return memcmp(sent, hashBuffer.getBuffAddr(), HASH_DIGEST_LENGTH) == 0;
 }
 
 DeframingProtocol::DeframingStatus FprimeDeframing::deframe(Types::CircularBuffer& ring, U32& needed) {
@@ -37,6 +37,23 @@ class FramingProtocolInterface {
     //! \param outgoing: framed data wrapped in an Fw::Buffer
     virtual void send(Fw::Buffer& outgoing) = 0;
 
+    //! \brief send a frame as its header, data and trailer without assembling them
+    //!
+    //! Lets a framing protocol send the data where it lies rather than copying it into an allocated frame. The parts
+    //! remain owned by the caller and need only stay valid for the duration of the call.
+    //! \param header: bytes sent before the data
+    //! \param header_size: size of the header
+    //! \param data: data being framed
+    //! \param data_size: size of the data
+    //! \param trailer: bytes sent after the data
+    //! \param trailer_size: size of the trailer
+    //! \return true if the frame was sent, false if the frame must instead be allocated and sent with `send`
+    virtual bool sendGather(const U8* const header, const U32 header_size,
+                            const U8* const data, const U32 data_size,
+                            const U8* const trailer, const U32 trailer_size) {
+        return false;
+    }
+
 };
 
 }
@@ -24,7 +24,8 @@ namespace Svc {
 // Construction, initialization, and destruction
 // ----------------------------------------------------------------------
 
-GenericHubComponentImpl ::GenericHubComponentImpl(const char* const compName) : GenericHubComponentBase(compName) {}
+GenericHubComponentImpl ::GenericHubComponentImpl(const char* const compName)
+    : GenericHubComponentBase(compName), m_batchSize(0) {}
 
 void GenericHubComponentImpl ::init(const NATIVE_INT_TYPE instance) {
     GenericHubComponentBase::init(instance);
@@ -32,25 +33,68 @@ void GenericHubComponentImpl ::init(const NATIVE_INT_TYPE instance) {
 
 GenericHubComponentImpl ::~GenericHubComponentImpl() {}
 
+void GenericHubComponentImpl ::setBatchSize(const U32 batchSize) {
+    this->send_batch();
+    m_batchSize = batchSize;
+}
+
 void GenericHubComponentImpl ::send_data(const HubType type,
                                          const NATIVE_INT_TYPE port,
                                          const U8* data,
                                          const U32 size) {
     FW_ASSERT(data != nullptr);
-    Fw::SerializeStatus status;
+    // Port calls that fit are batched. Buffers are always sent alone so the remote hub can hand the incoming buffer
+    // to the buffer output, and any pending batch is sent first to keep the calls in order.
+    if (type == HUB_TYPE_PORT && size + GENERIC_HUB_RECORD_HEADER_SIZE <= m_batchSize) {
+        this->batch_data(port, data, size);
+        return;
+    }
+    this->send_batch();
     // Buffer to send and a buffer used to write to it
-    Fw::Buffer outgoing = dataOutAllocate_out(0, size + sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType));
+    Fw::Buffer outgoing = dataOutAllocate_out(0, size + GENERIC_HUB_RECORD_HEADER_SIZE);
     Fw::SerializeBufferBase& serialize = outgoing.getSerializeRepr();
     // Write data to our buffer
+    serialize_record(serialize, type, port, data, size);
+    outgoing.setSize(serialize.getBuffLength());
+    dataOut_out(0, outgoing);
+
+}
+
+void GenericHubComponentImpl ::batch_data(const NATIVE_INT_TYPE port, const U8* data, const U32 size) {
+    if (m_batch.getData() != nullptr &&
+        m_batchSerializer.getBuffLength() + size + GENERIC_HUB_RECORD_HEADER_SIZE > m_batchSize) {
+        this->send_batch();
+    }
+    if (m_batch.getData() == nullptr) {
+        m_batch = dataOutAllocate_out(0, m_batchSize);
+        m_batchSerializer.setExtBuffer(m_batch.getData(), m_batch.getSize());
+        m_batchSerializer.resetSer();
+    }
+    serialize_record(m_batchSerializer, HUB_TYPE_PORT, port, data, size);
+}
+
+void GenericHubComponentImpl ::send_batch() {
+    if (m_batch.getData() == nullptr) {
+        return;
+    }
+    m_batch.setSize(m_batchSerializer.getBuffLength());
+    dataOut_out(0, m_batch);
+    m_batch = Fw::Buffer();
+    m_batchSerializer.clear();
+}
+
+void GenericHubComponentImpl ::serialize_record(Fw::SerializeBufferBase& serialize,
+                                                const HubType type,
+                                                const NATIVE_INT_TYPE port,
+                                                const U8* data,
+                                                const U32 size) {
+    Fw::SerializeStatus status;
     status = serialize.serialize(static_cast<U32>(type));
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
     status = serialize.serialize(static_cast<U32>(port));
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
     status = serialize.serialize(data, size);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    outgoing.setSize(serialize.getBuffLength());
-    dataOut_out(0, outgoing);
-
 }
 
 // ----------------------------------------------------------------------
@@ -77,30 +121,45 @@ void GenericHubComponentImpl ::dataIn_handler(const NATIVE_INT_TYPE portNum,
     // Must inform buffer that there is *real* data in the buffer
     status = incoming.setBuffLen(fwBuffer.getSize());
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    status = incoming.deserialize(type_in);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    type = static_cast<HubType>(type_in);
-    FW_ASSERT(type < HUB_TYPE_MAX, type);
-    status = incoming.deserialize(port);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    status = incoming.deserialize(size);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
 
-    // invokeSerial deserializes arguments before calling a normal invoke, this will return ownership immediately
-    U8* rawData = fwBuffer.getData() + sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType);
-    U32 rawSize = fwBuffer.getSize() - sizeof(U32) - sizeof(U32) - sizeof(FwBuffSizeType);
-    FW_ASSERT(rawSize == static_cast<U32>(size));
-    if (type == HUB_TYPE_PORT) {
-        // Com buffer representations should be copied before the call returns, so we need not "allocate" new data
-        Fw::ExternalSerializeBuffer wrapper(rawData, rawSize);
-        status = wrapper.setBuffLen(rawSize);
+    // A batching hub packs several port records into one buffer, so read records until the buffer is used up
+    while (incoming.getBuffLeft() > 0) {
+        status = incoming.deserialize(type_in);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+        type = static_cast<HubType>(type_in);
+        FW_ASSERT(type < HUB_TYPE_MAX, type);
+        status = incoming.deserialize(port);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+        status = incoming.deserialize(size);
         FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-        portOut_out(port, wrapper);
-        dataInDeallocate_out(0, fwBuffer);
-    } else if (type == HUB_TYPE_BUFFER) {
-        fwBuffer.set(rawData, rawSize, fwBuffer.getContext());
-        buffersOut_out(port, fwBuffer);
+
+        // invokeSerial deserializes arguments before calling a normal invoke, this will return ownership immediately
+        U8* rawData = fwBuffer.getData() + (fwBuffer.getSize() - incoming.getBuffLeft());
+        U32 rawSize = static_cast<U32>(size);
+        FW_ASSERT(rawSize <= incoming.getBuffLeft(), rawSize, incoming.getBuffLeft());
+        if (type == HUB_TYPE_PORT) {
+            // Com buffer representations should be copied before the call returns, so we need not "allocate" new data
+            Fw::ExternalSerializeBuffer wrapper(rawData, rawSize);
+            status = wrapper.setBuffLen(rawSize);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+            portOut_out(port, wrapper);
+            if (rawSize > 0) {
+                status = incoming.deserializeSkip(rawSize);
+                FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+            }
+        } else if (type == HUB_TYPE_BUFFER) {
+            // Buffers are sent alone, so the buffer record ends the incoming data and takes ownership of it
+            FW_ASSERT(rawSize == incoming.getBuffLeft(), rawSize, incoming.getBuffLeft());
+            fwBuffer.set(rawData, rawSize, fwBuffer.getContext());
+            buffersOut_out(port, fwBuffer);
+            return;
+        }
     }
+    dataInDeallocate_out(0, fwBuffer);
+}
+
+void GenericHubComponentImpl ::schedIn_handler(const NATIVE_INT_TYPE portNum, NATIVE_UINT_TYPE context) {
+    this->send_batch();
 }
 
 // ----------------------------------------------------------------------
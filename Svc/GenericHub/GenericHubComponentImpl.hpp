@@ -31,6 +31,8 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
     };
 
     const static U32 GENERIC_HUB_DATA_SIZE = 1024;
+    //! Size of the type, port, and size fields before each record's data
+    const static U32 GENERIC_HUB_RECORD_HEADER_SIZE = sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType);
     // ----------------------------------------------------------------------
     // Construction, initialization, and destruction
     // ----------------------------------------------------------------------
@@ -49,6 +51,14 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
     //!
     ~GenericHubComponentImpl();
 
+    //! Set the batch size for outgoing port calls
+    //!
+    //! Port calls are packed into outgoing buffers of up to batchSize bytes. A batch is sent when the next record
+    //! does not fit, before any buffer is sent, and on each schedIn call. A batch size of 0 (the default) sends each
+    //! port call in its own buffer. The remote hub unpacks batches with no configuration.
+    void setBatchSize(const U32 batchSize /*!< The largest outgoing batch in bytes, or 0 to not batch*/
+    );
+
   PRIVATE:
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined typed input ports
@@ -64,6 +74,12 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
     void dataIn_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
                         Fw::Buffer& fwBuffer);
 
+    //! Handler implementation for schedIn
+    //!
+    void schedIn_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                         NATIVE_UINT_TYPE context       /*!< The call order*/
+    );
+
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined serial input ports
     // ----------------------------------------------------------------------
@@ -76,6 +92,23 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
 
     // Helpers and members
     void send_data(const HubType type, const NATIVE_INT_TYPE port, const U8* data, const U32 size);
+
+    //! Append a port call to the current batch, starting a new batch if needed
+    void batch_data(const NATIVE_INT_TYPE port, const U8* data, const U32 size);
+
+    //! Send the current batch, if any
+    void send_batch();
+
+    //! Serialize one record to a buffer
+    static void serialize_record(Fw::SerializeBufferBase& serialize,
+                                 const HubType type,
+                                 const NATIVE_INT_TYPE port,
+                                 const U8* data,
+                                 const U32 size);
+
+    U32 m_batchSize;                                 //!< Largest outgoing batch in bytes, 0 to not batch
+    Fw::Buffer m_batch;                              //!< Buffer holding the current batch, if any
+    Fw::ExternalSerializeBuffer m_batchSerializer;   //!< Serializer writing records into m_batch
 };
 
 }  // end namespace Svc
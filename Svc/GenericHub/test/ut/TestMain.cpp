@@ -20,6 +20,16 @@ TEST(Nominal, TestRandomIo) {
     tester.test_random_io();
 }
 
+TEST(Nominal, TestBatchedIo) {
+    Svc::Tester tester;
+    tester.test_batched_io();
+}
+
+TEST(Nominal, TestBatchCounts) {
+    Svc::Tester tester;
+    tester.test_batch_counts();
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -15,6 +15,8 @@
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10000
+#define NUM_BATCHED_CALLS 1000
+#define NUM_COUNTED_CALLS 5000
 
 namespace Svc {
 
@@ -31,7 +33,9 @@ Tester ::Tester()
       m_buffer_in(0),
       m_comm_out(0),
       m_buffer_out(0),
-      m_current_port(0) {
+      m_current_port(0),
+      m_pattern(false),
+      m_data_out(0) {
     this->initComponents();
     this->connectPorts();
 }
@@ -74,8 +78,100 @@ void Tester ::test_random_io() {
         fromPortHistory_dataInDeallocate->clear();
     }
 }
+void Tester ::test_batched_io() {
+    m_pattern = true;
+    this->componentIn.setBatchSize(GenericHubComponentImpl::GENERIC_HUB_DATA_SIZE);
+    for (U32 i = 0; i < NUM_BATCHED_CALLS; i++) {
+        send_pattern_comm(i);
+    }
+    // Full batches have gone out, and the rest goes out on schedIn
+    ASSERT_LT(m_comm_out, static_cast<U32>(NUM_BATCHED_CALLS));
+    invoke_to_schedIn(0, 0);
+    ASSERT_EQ(static_cast<U32>(NUM_BATCHED_CALLS), m_comm_out);
+    ASSERT_LT(fromPortHistory_dataOut->size(), static_cast<U32>(NUM_BATCHED_CALLS / 10));
+    ASSERT_from_dataInDeallocate_SIZE(fromPortHistory_dataOut->size());
+
+    // Nothing is pending, so schedIn sends nothing
+    this->clearFromPortHistory();
+    invoke_to_schedIn(0, 0);
+    ASSERT_from_dataOut_SIZE(0);
+
+    // A buffer sends the pending batch first, so the calls arrive in order
+    send_pattern_comm(NUM_BATCHED_CALLS);
+    send_pattern_comm(NUM_BATCHED_CALLS + 1);
+    ASSERT_from_dataOut_SIZE(0);
+    m_buffer.set(m_data_store, 10);
+    m_current_port = 0;
+    invoke_to_buffersIn(m_current_port, m_buffer);
+    ASSERT_from_dataOut_SIZE(2);
+    ASSERT_EQ(static_cast<U32>(NUM_BATCHED_CALLS + 2), m_comm_out);
+    ASSERT_EQ(1U, m_buffer_out);
+    ASSERT_from_dataInDeallocate_SIZE(2);
+
+    // Calls too large for a batch are sent alone
+    this->clearFromPortHistory();
+    this->componentIn.setBatchSize(GenericHubComponentImpl::GENERIC_HUB_RECORD_HEADER_SIZE + 10);
+    ASSERT_from_dataOut_SIZE(0);
+    for (U32 i = NUM_BATCHED_CALLS + 2; i < NUM_BATCHED_CALLS + 50; i++) {
+        send_pattern_comm(i);
+    }
+    invoke_to_schedIn(0, 0);
+    ASSERT_EQ(static_cast<U32>(NUM_BATCHED_CALLS + 50), m_comm_out);
+}
+
+void Tester ::test_batch_counts() {
+    m_pattern = true;
+    const U32 batchSizes[] = {0, GenericHubComponentImpl::GENERIC_HUB_RECORD_HEADER_SIZE + 20,
+                              GenericHubComponentImpl::GENERIC_HUB_DATA_SIZE};
+    U32 index = 0;
+    for (U32 b = 0; b < FW_NUM_ARRAY_ELEMENTS(batchSizes); b++) {
+        this->componentIn.setBatchSize(batchSizes[b]);
+        // Calls are packed in order until the next one does not fit; calls too large for a batch go alone
+        U32 expected = 0;
+        U32 pending = 0;
+        const U32 dataOutStart = m_data_out;
+        for (U32 i = 0; i < NUM_COUNTED_CALLS; i++) {
+            const U32 record = GenericHubComponentImpl::GENERIC_HUB_RECORD_HEADER_SIZE + index % 40;
+            if (pending > 0 && pending + record > batchSizes[b]) {
+                expected++;
+                pending = 0;
+            }
+            if (record > batchSizes[b]) {
+                expected++;
+            } else {
+                pending += record;
+            }
+            send_pattern_comm(index++);
+            this->clearFromPortHistory();
+        }
+        invoke_to_schedIn(0, 0);
+        expected += (pending > 0) ? 1 : 0;
+        ASSERT_EQ(index, m_comm_out);
+        ASSERT_EQ(expected, m_data_out - dataOutStart) << "batch size " << batchSizes[b];
+        this->clearFromPortHistory();
+    }
+}
+
 // Helpers
 
+void Tester ::send_pattern_comm(U32 index) {
+    fill_pattern_comm(m_comm, index);
+    invoke_to_portIn(pattern_port(index), m_comm);
+    m_comm_in++;
+}
+
+void Tester ::fill_pattern_comm(Fw::ComBuffer& comm, U32 index) {
+    comm.resetSer();
+    const U32 size = index % 40;
+    for (U32 i = 0; i < size; i++) {
+        comm.serialize(static_cast<U8>(index + i));
+    }
+}
+
+U32 Tester ::pattern_port(U32 index) {
+    return index % std::min(this->componentIn.getNum_portIn_InputPorts(), this->componentOut.getNum_portOut_OutputPorts());
+}
+
 void Tester ::send_random_comm(U32 port) {
     U32 random_size = STest::Pick::lowerUpper(0, FW_COM_BUFFER_MAX_SIZE);
     m_comm.resetSer();
@@ -119,6 +215,7 @@ void Tester ::from_dataOut_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fw
     ASSERT_GE(fwBuffer.getData(), m_data_for_allocation) << "Incorrect data pointer deallocated";
     ASSERT_LT(fwBuffer.getData(), m_data_for_allocation + sizeof(m_data_for_allocation)) << "Incorrect data pointer deallocated";
     // Reuse m_allocate to pass into the otherside of the hub
+    m_data_out++;
     this->pushFromPortEntry_dataOut(fwBuffer);
     invoke_to_dataIn(0, fwBuffer);
 
@@ -146,6 +243,17 @@ void Tester ::from_portOut_handler(NATIVE_INT_TYPE portNum,        /*!< The port
                                    Fw::SerializeBufferBase& Buffer /*!< The serialization buffer*/
 ) {
     m_comm_out++;
+    if (m_pattern) {
+        // Batched calls arrive after later calls were made, so check against the pattern for this call
+        Fw::ComBuffer expected;
+        fill_pattern_comm(expected, m_comm_out - 1);
+        ASSERT_EQ(static_cast<U32>(portNum), pattern_port(m_comm_out - 1));
+        ASSERT_EQ(Buffer.getBuffLength(), expected.getBuffLength());
+        for (U32 i = 0; i < Buffer.getBuffLength(); i++) {
+            ASSERT_EQ(Buffer.getBuffAddr()[i], expected.getBuffAddr()[i]);
+        }
+        return;
+    }
     // Assert the buffer came through exactly on the right port
     ASSERT_EQ(portNum, m_current_port);
     ASSERT_EQ(Buffer.getBuffLength(), m_comm.getBuffLength());
@@ -192,6 +300,9 @@ void Tester ::connectPorts() {
     // dataIn
     this->connect_to_dataIn(0, this->componentOut.get_dataIn_InputPort(0));
 
+    // schedIn
+    this->connect_to_schedIn(0, this->componentIn.get_schedIn_InputPort(0));
+
     // buffersOut
     for (U32 i = 0; i < max; ++i) {
         this->componentOut.set_buffersOut_OutputPort(i, this->get_from_buffersOut(i));
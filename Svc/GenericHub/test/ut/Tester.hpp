@@ -52,6 +52,14 @@ class Tester : public GenericHubGTestBase {
     //!
     void test_random_io();
 
+    //! Test of batched port calls, including a buffer sent while a batch is pending
+    //!
+    void test_batched_io();
+
+    //! Test the number of buffers sent for many port calls with and without batching
+    //!
+    void test_batch_counts();
+
   private:
     // ----------------------------------------------------------------------
     // Handlers for typed from ports
@@ -98,6 +106,15 @@ class Tester : public GenericHubGTestBase {
 
     void send_random_buffer(U32 port);
 
+    //! Send the port call numbered index, whose port and data are derived from index
+    void send_pattern_comm(U32 index);
+
+    //! Fill a com buffer with the data of the port call numbered index
+    static void fill_pattern_comm(Fw::ComBuffer& comm, U32 index);
+
+    //! Get the port of the port call numbered index
+    U32 pattern_port(U32 index);
+
     // ----------------------------------------------------------------------
     // Helper methods
     // ----------------------------------------------------------------------
@@ -127,6 +144,8 @@ class Tester : public GenericHubGTestBase {
     U32 m_comm_out;
     U32 m_buffer_out;
     U32 m_current_port;
+    bool m_pattern;     //!< Check port calls against the pattern rather than m_comm
+    U32 m_data_out;     //!< Number of buffers sent on dataOut
     U8 m_data_store[DATA_SIZE];
     U8 m_data_for_allocation[DATA_SIZE];
 };
@@ -19,32 +19,27 @@
 
 namespace Svc {
 
+    static_assert(TLMCHAN_NUM_TLM_HASH_SLOTS > TLMCHAN_HASH_BUCKETS,
+        "TLMCHAN_NUM_TLM_HASH_SLOTS must be larger than TLMCHAN_HASH_BUCKETS");
+
     TlmChanImpl::TlmChanImpl(const char* name) : TlmChanComponentBase(name)
     {
         // clear data
-        this->m_activeBuffer = 0;
-        // clear slot pointers
-        for (NATIVE_UINT_TYPE entry = 0; entry < TLMCHAN_NUM_TLM_HASH_SLOTS; entry++) {
-            this->m_tlmEntries[0].slots[entry] = nullptr;
-            this->m_tlmEntries[1].slots[entry] = nullptr;
+        this->m_numEntries = 0;
+        this->m_batch = false;
+        this->m_updatedHead.store(-1);
+        // clear slots
+        for (NATIVE_UINT_TYPE slot = 0; slot < TLMCHAN_NUM_TLM_HASH_SLOTS; slot++) {
+            this->m_slotIds[slot] = 0;
+            this->m_slotEntries[slot].store(-1);
         }
-        // clear buckets
+        // clear entries
         for (NATIVE_UINT_TYPE entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-            this->m_tlmEntries[0].buckets[entry].used = false;
-            this->m_tlmEntries[0].buckets[entry].updated = false;
-            this->m_tlmEntries[0].buckets[entry].bucketNo = entry;
-            this->m_tlmEntries[0].buckets[entry].next = nullptr;
-            this->m_tlmEntries[0].buckets[entry].id = 0;
-            this->m_tlmEntries[1].buckets[entry].used = false;
-            this->m_tlmEntries[1].buckets[entry].updated = false;
-            this->m_tlmEntries[1].buckets[entry].bucketNo = entry;
-            this->m_tlmEntries[1].buckets[entry].next = nullptr;
-            this->m_tlmEntries[1].buckets[entry].id = 0;
+            this->m_entryIds[entry] = 0;
+            this->m_entrySeq[entry].store(0);
+            this->m_updated[entry].store(false);
+            this->m_updatedNext[entry] = -1;
         }
-        // clear free index
-        this->m_tlmEntries[0].free = 0;
-        this->m_tlmEntries[1].free = 0;
-
 
     }
 
@@ -58,8 +53,57 @@ namespace Svc {
         TlmChanComponentBase::init(queueDepth,instance);
     }
 
+    void TlmChanImpl::setBatching(bool batch) {
+        this->m_batch = batch;
+    }
+
     NATIVE_UINT_TYPE TlmChanImpl::doHash(FwChanIdType id) {
-        return (id % TLMCHAN_HASH_MOD_VALUE)%TLMCHAN_NUM_TLM_HASH_SLOTS;
+        // multiplicative hash spreads the clustered IDs of each component across the table
+        return static_cast<U32>(id * 2654435761U) % TLMCHAN_NUM_TLM_HASH_SLOTS;
+    }
+
+    NATIVE_INT_TYPE TlmChanImpl::findEntry(FwChanIdType id, NATIVE_UINT_TYPE& slot) {
+        slot = this->doHash(id);
+        FW_ASSERT(slot < TLMCHAN_NUM_TLM_HASH_SLOTS,slot);
+        // there are more slots than entries, so there is always an empty slot to stop on
+        while (true) {
+            // acquire pairs with the release when the slot is filled, so the ID is valid
+            const NATIVE_INT_TYPE entry = this->m_slotEntries[slot].load(std::memory_order_acquire);
+            if (-1 == entry) {
+                return -1;
+            }
+            if (this->m_slotIds[slot] == id) {
+                return entry;
+            }
+            slot = (slot + 1) % TLMCHAN_NUM_TLM_HASH_SLOTS;
+        }
+    }
+
+    bool TlmChanImpl::readEntry(NATIVE_UINT_TYPE entry, Fw::Time& timeTag, Fw::TlmBuffer& val) {
+        FW_ASSERT(entry < TLMCHAN_HASH_BUCKETS,entry);
+        for (NATIVE_UINT_TYPE retry = 0; retry < TLMCHAN_MAX_READ_RETRIES; retry++) {
+            const U32 seq = this->m_entrySeq[entry].load(std::memory_order_acquire);
+            if (seq & 1) {
+                // write in progress
+                continue;
+            }
+            timeTag = this->m_lastUpdate[entry];
+            val = this->m_buffer[entry];
+            // keep the copy from moving past the second read of the counter
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (this->m_entrySeq[entry].load(std::memory_order_relaxed) == seq) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TlmChanImpl::pushUpdated(NATIVE_UINT_TYPE entry) {
+        FW_ASSERT(entry < TLMCHAN_HASH_BUCKETS,entry);
+        NATIVE_INT_TYPE head = this->m_updatedHead.load(std::memory_order_relaxed);
+        do {
+            this->m_updatedNext[entry] = head;
+        } while (not this->m_updatedHead.compare_exchange_weak(head,entry,std::memory_order_release,std::memory_order_relaxed));
     }
 
     void TlmChanImpl::pingIn_handler(
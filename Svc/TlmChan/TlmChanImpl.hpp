@@ -18,6 +18,8 @@
 #include <Os/Mutex.hpp>
 #include <Fw/Tlm/TlmPacket.hpp>
 
+#include <atomic>
+
 namespace Svc {
 
     class TlmChanImpl: public TlmChanComponentBase {
@@ -29,6 +31,10 @@ namespace Svc {
                     NATIVE_INT_TYPE queueDepth, /*!< The queue depth*/
                     NATIVE_INT_TYPE instance /*!< The instance number*/
                     );
+
+            //! Pack as many channel values as fit into each packet sent on PktSend.
+            //! By default each channel value is sent in its own packet.
+            void setBatching(bool batch /*!< true to pack multiple values per packet*/);
         PROTECTED:
 
             // can be overridden for alternate algorithms
@@ -47,27 +53,56 @@ namespace Svc {
                 U32 key /*!< Value to return to pinger*/
             );
 
-            typedef struct tlmEntry {
-                FwChanIdType id; //!< telemetry id stored in slot
-                bool updated; //!< set whenever a value has been written. Used to skip if writing out values for downlinking
-                Fw::Time lastUpdate; //!< last updated time
-                Fw::TlmBuffer buffer; //!< buffer to store serialized telemetry
-                tlmEntry* next; //!< pointer to next bucket in table
-                bool used; //!< if entry has been used
-                NATIVE_UINT_TYPE bucketNo; //!< for testing
-            } TlmEntry;
+            //!  \brief Find the entry for a channel
+            //!
+            //!  \param id the channel ID to look up
+            //!  \param slot set to the hash table slot holding the ID, or the empty slot where it would be added
+            //!  \return the entry index, or -1 if the channel has not been written
+            NATIVE_INT_TYPE findEntry(FwChanIdType id, NATIVE_UINT_TYPE& slot);
+
+            //!  \brief Read a consistent copy of an entry
+            //!
+            //!  Retries while a write to the entry is in progress, up to
+            //!  TLMCHAN_MAX_READ_RETRIES times.
+            //!
+            //!  \param entry the entry to read
+            //!  \param timeTag set to the time of the last update
+            //!  \param val set to the serialized channel value
+            //!  \return true if the copy is consistent, false if writers kept the entry busy
+            bool readEntry(NATIVE_UINT_TYPE entry, Fw::Time& timeTag, Fw::TlmBuffer& val);
+
+            //!  \brief Add an entry to the list of entries to send
+            //!
+            //!  \param entry the entry that was updated
+            void pushUpdated(NATIVE_UINT_TYPE entry);
+
+            // Open-addressed hash table of channel IDs. Entries are never
+            // removed, so a probe stops at the first empty slot. Slots are
+            // filled under m_insertLock and published by storing the entry index.
+            FwChanIdType m_slotIds[TLMCHAN_NUM_TLM_HASH_SLOTS]; //!< channel ID stored in slot
+            std::atomic<NATIVE_INT_TYPE> m_slotEntries[TLMCHAN_NUM_TLM_HASH_SLOTS]; //!< entry index for slot, -1 if slot is empty
+            NATIVE_UINT_TYPE m_numEntries; //!< number of entries in use
+            Os::Mutex m_insertLock; //!< serializes adding new channels
 
-            struct TlmSet {
-                TlmEntry* slots[TLMCHAN_NUM_TLM_HASH_SLOTS]; //!< set of hash slots in hash table
-                TlmEntry buckets[TLMCHAN_HASH_BUCKETS]; //!< set of buckets used in hash table
-                NATIVE_INT_TYPE free; //!< next free bucket
-            } m_tlmEntries[2];
+            // Channel values are kept in parallel arrays indexed by entry number.
+            // Each entry is protected by a sequence counter that is odd while
+            // a write is in progress, so readers retry instead of locking.
+            FwChanIdType m_entryIds[TLMCHAN_HASH_BUCKETS]; //!< channel ID of each entry
+            std::atomic<U32> m_entrySeq[TLMCHAN_HASH_BUCKETS]; //!< sequence counter of each entry
+            Fw::Time m_lastUpdate[TLMCHAN_HASH_BUCKETS]; //!< last updated time
+            Fw::TlmBuffer m_buffer[TLMCHAN_HASH_BUCKETS]; //!< buffer to store serialized telemetry
 
-            U32 m_activeBuffer; // !< which buffer is active for storing telemetry
+            // Entries written since the last packet sweep are pushed on a
+            // lock-free list. The sweep takes the whole list at once.
+            std::atomic<bool> m_updated[TLMCHAN_HASH_BUCKETS]; //!< set whenever a value has been written. Used to skip if writing out values for downlinking
+            NATIVE_INT_TYPE m_updatedNext[TLMCHAN_HASH_BUCKETS]; //!< next entry on the updated list
+            std::atomic<NATIVE_INT_TYPE> m_updatedHead; //!< most recently updated entry, -1 if none
 
             // work variables
             Fw::ComBuffer m_comBuffer;
             Fw::TlmPacket m_tlmPacket;
+            NATIVE_UINT_TYPE m_sendList[TLMCHAN_HASH_BUCKETS]; //!< updated entries in the order they are sent
+            bool m_batch; //!< pack multiple channel values per packet
 
     };
 
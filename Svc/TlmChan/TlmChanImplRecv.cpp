@@ -9,6 +9,7 @@
 #include <cstring>
 #include <Fw/Types/BasicTypes.hpp>
 #include <Fw/Types/Assert.hpp>
+#include <Os/Task.hpp>
 
 #include <cstdio>
 
@@ -16,51 +17,50 @@ namespace Svc {
 
     void TlmChanImpl::TlmRecv_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time &timeTag, Fw::TlmBuffer &val) {
 
-        // Compute index for entry
+        // Look up entry for channel
+        NATIVE_UINT_TYPE slot;
+        NATIVE_INT_TYPE entry = this->findEntry(id,slot);
 
-        NATIVE_UINT_TYPE index = this->doHash(id);
-        TlmEntry* entryToUse = nullptr;
-        TlmEntry* prevEntry = nullptr;
+        if (-1 == entry) {
+            // only adding a channel takes a lock; search again in case another writer added it
+            this->m_insertLock.lock();
+            entry = this->findEntry(id,slot);
+            if (-1 == entry) {
+                // Make sure that we haven't run out of buckets
+                FW_ASSERT(this->m_numEntries < TLMCHAN_HASH_BUCKETS,id);
+                // add new entry at the empty slot
+                entry = this->m_numEntries++;
+                this->m_entryIds[entry] = id;
+                this->m_slotIds[slot] = id;
+                this->m_slotEntries[slot].store(entry,std::memory_order_release);
+            }
+            this->m_insertLock.unLock();
+        }
 
-        // Search to see if channel has already been stored or a bucket needs to be added
-        if (this->m_tlmEntries[this->m_activeBuffer].slots[index]) {
-            entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
-            for (NATIVE_UINT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-                if (entryToUse) {
-                    if (entryToUse->id == id) { // found the matching entry
-                        break;
-                    } else { // try next entry
-                        prevEntry = entryToUse;
-                        entryToUse = entryToUse->next;
-                    }
-                } else {
-                    // Make sure that we haven't run out of buckets
-                    FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
-                    // add new bucket from free list
-                    entryToUse = &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
-                    FW_ASSERT(prevEntry);
-                    prevEntry->next = entryToUse;
-                    // clear next pointer
-                    entryToUse->next = nullptr;
-                    break;
+        // make the sequence counter odd to claim the entry; waits only for another writer of the same channel.
+        // The other writer may have been preempted by this one, so back off with a sleep rather than spinning forever.
+        std::atomic<U32>& entrySeq = this->m_entrySeq[entry];
+        U32 seq = entrySeq.load(std::memory_order_relaxed);
+        NATIVE_UINT_TYPE spins = 0;
+        do {
+            while (seq & 1) {
+                if (++spins >= TLMCHAN_WRITE_SPINS) {
+                    (void) Os::Task::delay(1);
+                    spins = 0;
                 }
+                seq = entrySeq.load(std::memory_order_relaxed);
             }
-        } else {
-            // Make sure that we haven't run out of buckets
-            FW_ASSERT(this->m_tlmEntries[this->m_activeBuffer].free < TLMCHAN_HASH_BUCKETS);
-            // create new entry at slot head
-            this->m_tlmEntries[this->m_activeBuffer].slots[index] = &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
-            entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
-            entryToUse->next = nullptr;
-        }
+        } while (not entrySeq.compare_exchange_weak(seq,seq+1,std::memory_order_acquire,std::memory_order_relaxed));
 
         // copy into entry
-        FW_ASSERT(entryToUse);
-        entryToUse->used = true;
-        entryToUse->id = id;
-        entryToUse->updated = true;
-        entryToUse->lastUpdate = timeTag;
-        entryToUse->buffer = val;
+        this->m_lastUpdate[entry] = timeTag;
+        this->m_buffer[entry] = val;
+        entrySeq.store(seq+2,std::memory_order_release);
+
+        // add to the list to send if not already there
+        if (not this->m_updated[entry].exchange(true,std::memory_order_acq_rel)) {
+            this->pushUpdated(entry);
+        }
 
     }
 }
@@ -27,30 +27,62 @@ namespace Svc {
             return;
         }
 
-        // lock mutex long enough to modify active telemetry buffer
-        // so the data can be read without worrying about updates
-        this->lock();
-        this->m_activeBuffer = 1 - this->m_activeBuffer;
-        // set activeBuffer to not updated
-        for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-            this->m_tlmEntries[this->m_activeBuffer].buckets[entry].updated = false;
+        // take the whole list of updated entries. Writers start a new list,
+        // so no lock is needed.
+        NATIVE_INT_TYPE head = this->m_updatedHead.exchange(-1,std::memory_order_acquire);
+
+        // the list is newest first; reverse it so channels go out in the order they were first written
+        NATIVE_UINT_TYPE numUpdated = 0;
+        while (head != -1) {
+            FW_ASSERT(numUpdated < TLMCHAN_HASH_BUCKETS,numUpdated);
+            this->m_sendList[numUpdated++] = head;
+            head = this->m_updatedNext[head];
+        }
+
+        if (this->m_batch) {
+            // packets are built in the same buffer as single values
+            this->m_tlmPacket.setBuffer(this->m_comBuffer);
+            Fw::SerializeStatus stat = this->m_tlmPacket.resetPktSer();
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
         }
-        this->unLock();
-
-        // go through each entry and send a packet if it has been updated
-
-        for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
-            TlmEntry* p_entry = &this->m_tlmEntries[1-this->m_activeBuffer].buckets[entry];
-            if ((p_entry->updated) && (p_entry->used)) {
-                this->m_tlmPacket.setId(p_entry->id);
-                this->m_tlmPacket.setTimeTag(p_entry->lastUpdate);
-                this->m_tlmPacket.setTlmBuffer(p_entry->buffer);
-                this->m_comBuffer.resetSer();
-                Fw::SerializeStatus stat = this->m_tlmPacket.serialize(this->m_comBuffer);
+
+        // go through each entry that has been updated and send a packet
+
+        for (NATIVE_UINT_TYPE updated = numUpdated; updated > 0; updated--) {
+            const NATIVE_UINT_TYPE entry = this->m_sendList[updated-1];
+            // clear the flag before reading so a later write puts the entry back on the list
+            (void) this->m_updated[entry].exchange(false,std::memory_order_acq_rel);
+            if (not this->readEntry(entry,this->m_tlmPacket.getTimeTag(),this->m_tlmPacket.getTlmBuffer())) {
+                // writers kept the entry busy; send it on the next cycle
+                if (not this->m_updated[entry].exchange(true,std::memory_order_acq_rel)) {
+                    this->pushUpdated(entry);
+                }
+                continue;
+            }
+            if (this->m_batch) {
+                Fw::SerializeStatus stat = this->m_tlmPacket.addValue(this->m_entryIds[entry],
+                        this->m_tlmPacket.getTimeTag(),this->m_tlmPacket.getTlmBuffer());
+                if (Fw::FW_SERIALIZE_NO_ROOM_LEFT == stat) {
+                    // packet is full; send it and start another
+                    this->PktSend_out(0,this->m_comBuffer,0);
+                    stat = this->m_tlmPacket.resetPktSer();
+                    FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+                    stat = this->m_tlmPacket.addValue(this->m_entryIds[entry],
+                            this->m_tlmPacket.getTimeTag(),this->m_tlmPacket.getTlmBuffer());
+                }
                 FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
-                p_entry->updated = false;
-                this->PktSend_out(0,this->m_comBuffer,0);
+                continue;
             }
+            this->m_tlmPacket.setId(this->m_entryIds[entry]);
+            this->m_comBuffer.resetSer();
+            Fw::SerializeStatus stat = this->m_tlmPacket.serialize(this->m_comBuffer);
+            FW_ASSERT(Fw::FW_SERIALIZE_OK == stat,static_cast<NATIVE_INT_TYPE>(stat));
+            this->PktSend_out(0,this->m_comBuffer,0);
+        }
+
+        // send the last partly filled packet
+        if (this->m_batch and (this->m_tlmPacket.getNumEntries() > 0)) {
+            this->PktSend_out(0,this->m_comBuffer,0);
         }
     }
 
@@ -8,13 +8,27 @@
 #include <Svc/TlmChan/test/ut/TlmChanImplTester.hpp>
 #include <Fw/Com/ComBuffer.hpp>
 #include <Fw/Com/ComPacket.hpp>
+#include <Fw/Tlm/TlmPacket.hpp>
 #include <Os/IntervalTimer.hpp>
 #include <Fw/Test/UnitTest.hpp>
 
 #include <cstdio>
+#include <atomic>
+#include <pthread.h>
 
 #include <gtest/gtest.h>
 
+// channels written by each thread in the concurrent write test
+#define CONCURRENT_CHANNELS 8
+#define CONCURRENT_MAX_THREADS 4
+#define CONCURRENT_WRITES 200000
+
+struct WriteArgs {
+    Svc::TlmChanImplTester* tester;
+    FwChanIdType firstId;
+    std::atomic<U32>* finished;
+};
+
 
 namespace Svc {
 
@@ -237,63 +251,216 @@ namespace Svc {
         }
     }
 
-    void TlmChanImplTester::dumpTlmEntry(TlmChanImpl::TlmEntry* entry) {
-        printf(
-                "Entry "
-                " Ptr: %p"
-                " id: 0x%08X"
-                " bucket: %d"
-                " next: %p\n",
-                static_cast<void *>(entry),entry->id,entry->bucketNo,static_cast<void *>(entry->next)
-                );
-    }
-
     void TlmChanImplTester::dumpHash() {
-//        printf("**Buffer 0\n");
-        for (NATIVE_INT_TYPE slot = 0; slot < TLMCHAN_NUM_TLM_HASH_SLOTS; slot++) {
-            printf("Slot: %d\n",slot);
-            if (m_impl.m_tlmEntries[0].slots[slot]) {
-                TlmChanImpl::TlmEntry* entry = m_impl.m_tlmEntries[0].slots[slot];
-                for (NATIVE_INT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-                    dumpTlmEntry(entry);
-                    if (entry->next == nullptr) {
-                        break;
-                    } else {
-                        entry = entry->next;
-                    }
-                }
+        for (NATIVE_UINT_TYPE slot = 0; slot < TLMCHAN_NUM_TLM_HASH_SLOTS; slot++) {
+            const NATIVE_INT_TYPE entry = m_impl.m_slotEntries[slot].load();
+            if (-1 == entry) {
+                printf("Slot: %d EMPTY\n",slot);
             } else {
-                printf("EMPTY\n");
+                // distance from the slot the ID hashes to
+                const NATIVE_UINT_TYPE home = m_impl.doHash(m_impl.m_slotIds[slot]);
+                printf("Slot: %d id: 0x%08X entry: %d probe: %d\n",
+                        slot,m_impl.m_slotIds[slot],entry,
+                        (slot + TLMCHAN_NUM_TLM_HASH_SLOTS - home) % TLMCHAN_NUM_TLM_HASH_SLOTS);
             }
         }
         printf("\n");
-//        for (NATIVE_INT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-//            printf("Bucket: %d ",bucket);
-//            dumpTlmEntry(&m_impl.m_tlmEntries[0].buckets[bucket]);
-//        }
-//        printf("**Buffer 1\n");
-//        for (NATIVE_INT_TYPE slot = 0; slot < TLMCHAN_NUM_TLM_HASH_SLOTS; slot++) {
-//            printf("Slot: %d\n",slot);
-//            if (m_impl.m_tlmEntries[1].slots[slot]) {
-//                TlmChanImpl::TlmEntry* entry = m_impl.m_tlmEntries[1].slots[slot];
-//                for (NATIVE_INT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-//                    dumpTlmEntry(entry);
-//                    if (entry->next == 0) {
-//                        break;
-//                    } else {
-//                        entry = entry->next;
-//                    }
-//                }
-//            } else {
-//                printf("EMPTY\n");
-//            }
-//        }
-//        printf("\n");
-//        for (NATIVE_INT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-//            printf("Bucket: %d\n",bucket);
-//            dumpTlmEntry(&m_impl.m_tlmEntries[1].buckets[bucket]);
-//        }
     }
+
+    NATIVE_UINT_TYPE TlmChanImplTester::countUpdated() {
+        NATIVE_UINT_TYPE count = 0;
+        for (NATIVE_INT_TYPE entry = m_impl.m_updatedHead.load(); entry != -1; entry = m_impl.m_updatedNext[entry]) {
+            count++;
+        }
+        return count;
+    }
+
+    void TlmChanImplTester::runChannelScaling() {
+
+        // IDs are clustered by component the way a deployment assigns them
+        const FwChanIdType componentStride = 0x100;
+        const NATIVE_UINT_TYPE channelsPerComponent = 8;
+        // channels updated between sweeps, spread across the table
+        const NATIVE_UINT_TYPE updateCounts[] = {1, 3, 11};
+
+        Fw::TlmBuffer buff;
+        Fw::Time timeTag;
+
+        NATIVE_UINT_TYPE numChannels = 0;
+        for (NATIVE_UINT_TYPE target = TLMCHAN_HASH_BUCKETS/4; numChannels < TLMCHAN_HASH_BUCKETS; target *= 2) {
+            if (target > TLMCHAN_HASH_BUCKETS) {
+                target = TLMCHAN_HASH_BUCKETS;
+            }
+            // add channels up to the target
+            for (; numChannels < target; numChannels++) {
+                buff.resetSer();
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.serialize(static_cast<U32>(numChannels)));
+                this->invoke_to_TlmRecv(0,
+                        (numChannels/channelsPerComponent)*componentStride + numChannels%channelsPerComponent,
+                        timeTag,buff);
+            }
+
+            // write every channel, then sweep with every channel updated
+            for (NATIVE_UINT_TYPE chan = 0; chan < numChannels; chan++) {
+                this->invoke_to_TlmRecv(0,
+                        (chan/channelsPerComponent)*componentStride + chan%channelsPerComponent,
+                        timeTag,buff);
+            }
+            ASSERT_EQ(numChannels,this->countUpdated());
+            this->clearBuffs();
+            this->doRun(true);
+            ASSERT_EQ(numChannels,this->m_numBuffs);
+
+            // the sweep visits only the updated channels, whatever the table size
+            for (NATIVE_UINT_TYPE count = 0; count < FW_NUM_ARRAY_ELEMENTS(updateCounts); count++) {
+                const NATIVE_UINT_TYPE numUpdated = updateCounts[count];
+                ASSERT_LE(numUpdated,numChannels);
+                for (NATIVE_UINT_TYPE update = 0; update < numUpdated; update++) {
+                    const NATIVE_UINT_TYPE chan = (update*numChannels)/numUpdated;
+                    this->invoke_to_TlmRecv(0,
+                            (chan/channelsPerComponent)*componentStride + chan%channelsPerComponent,
+                            timeTag,buff);
+                    // a second write of the same channel is not listed again
+                    this->invoke_to_TlmRecv(0,
+                            (chan/channelsPerComponent)*componentStride + chan%channelsPerComponent,
+                            timeTag,buff);
+                }
+                ASSERT_EQ(numUpdated,this->countUpdated());
+                this->clearBuffs();
+                this->doRun(false);
+                ASSERT_EQ(numUpdated,this->m_numBuffs);
+                ASSERT_EQ(0u,this->countUpdated());
+            }
+
+            // nothing updated, so nothing sent
+            this->clearBuffs();
+            ASSERT_FALSE(this->doRun(false));
+        }
+    }
+
+    void TlmChanImplTester::runBatchedChannels() {
+
+        this->m_impl.setBatching(true);
+
+        // write every channel
+        this->clearBuffs();
+        for (NATIVE_UINT_TYPE n = 0; n < TLMCHAN_HASH_BUCKETS; n++) {
+            this->sendBuff(n,n*7,0);
+        }
+
+        // values are packed, so fewer packets than channels are sent
+        this->doRun(true);
+        ASSERT_GT(this->m_numBuffs,0u);
+        ASSERT_LT(this->m_numBuffs,static_cast<NATIVE_UINT_TYPE>(TLMCHAN_HASH_BUCKETS));
+
+        // extract the values in the order they were written
+        Fw::TlmPacket pkt;
+        NATIVE_UINT_TYPE numValues = 0;
+        for (NATIVE_UINT_TYPE packet = 0; packet < this->m_numBuffs; packet++) {
+            pkt.setBuffer(this->m_rcvdBuffer[packet]);
+            ASSERT_EQ(Fw::FW_SERIALIZE_OK,pkt.resetPktDeser());
+            while (pkt.getBuffer().getBuffLeft() > 0) {
+                FwChanIdType id;
+                Fw::Time timeTag;
+                Fw::TlmBuffer val;
+                U32 readVal;
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,pkt.extractValue(id,timeTag,val,sizeof(U32)));
+                ASSERT_EQ(Fw::FW_SERIALIZE_OK,val.deserialize(readVal));
+                ASSERT_EQ(numValues,id);
+                ASSERT_EQ(numValues*7,readVal);
+                numValues++;
+            }
+        }
+        ASSERT_EQ(static_cast<NATIVE_UINT_TYPE>(TLMCHAN_HASH_BUCKETS),numValues);
+        printf("%d channels sent in %d packets\n",numValues,this->m_numBuffs);
+
+        // a single update is sent alone
+        this->clearBuffs();
+        this->sendBuff(3,99,0);
+        this->doRun(true);
+        ASSERT_EQ(1u,this->m_numBuffs);
+        this->checkBuff(3,99,0);
+
+        // nothing is sent when nothing is updated
+        this->clearBuffs();
+        ASSERT_FALSE(this->doRun(false));
+    }
+
+    void* TlmChanImplTester::writeTask(void* arg) {
+        WriteArgs* args = static_cast<WriteArgs*>(arg);
+        Fw::TlmBuffer buff;
+        Fw::Time timeTag;
+        for (U32 write = 0; write < CONCURRENT_WRITES; write++) {
+            // the value and its complement let readers detect a torn copy
+            buff.resetSer();
+            (void) buff.serialize(write);
+            (void) buff.serialize(~write);
+            args->tester->invoke_to_TlmRecv(0,args->firstId + write % CONCURRENT_CHANNELS,timeTag,buff);
+        }
+        args->finished->fetch_add(1);
+        return nullptr;
+    }
+
+    void TlmChanImplTester::checkPattern(Fw::SerializeBufferBase& buff) {
+        U32 val;
+        U32 complement;
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(val));
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK,buff.deserialize(complement));
+        ASSERT_EQ(~val,complement);
+    }
+
+    void TlmChanImplTester::runConcurrentWrites() {
+
+        ASSERT_LE(CONCURRENT_MAX_THREADS*CONCURRENT_CHANNELS,TLMCHAN_HASH_BUCKETS);
+
+        for (NATIVE_UINT_TYPE numThreads = 1; numThreads <= CONCURRENT_MAX_THREADS; numThreads *= 2) {
+            WriteArgs args[CONCURRENT_MAX_THREADS];
+            pthread_t threads[CONCURRENT_MAX_THREADS];
+            std::atomic<U32> finished(0);
+            NATIVE_UINT_TYPE sweeps = 0;
+
+            for (NATIVE_UINT_TYPE thread = 0; thread < numThreads; thread++) {
+                args[thread].tester = this;
+                args[thread].firstId = thread*0x100;
+                args[thread].finished = &finished;
+                ASSERT_EQ(0,pthread_create(&threads[thread],nullptr,writeTask,&args[thread]));
+            }
+
+            // sweep and read back while the writers run
+            while (finished.load() < numThreads) {
+                this->clearBuffs();
+                this->doRun(false);
+                for (NATIVE_UINT_TYPE packet = 0; packet < this->m_numBuffs; packet++) {
+                    FwPacketDescriptorType desc;
+                    FwChanIdType id;
+                    Fw::Time timeTag;
+                    this->m_rcvdBuffer[packet].resetDeser();
+                    ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_rcvdBuffer[packet].deserialize(desc));
+                    ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_rcvdBuffer[packet].deserialize(id));
+                    ASSERT_EQ(Fw::FW_SERIALIZE_OK,this->m_rcvdBuffer[packet].deserialize(timeTag));
+                    this->checkPattern(this->m_rcvdBuffer[packet]);
+                }
+                sweeps++;
+
+                Fw::TlmBuffer readBack;
+                Fw::Time timeTag;
+                this->invoke_to_TlmGet(0,(sweeps % numThreads)*0x100 + sweeps % CONCURRENT_CHANNELS,timeTag,readBack);
+                if (readBack.getBuffLength() > 0) {
+                    this->checkPattern(readBack);
+                }
+            }
+
+            for (NATIVE_UINT_TYPE thread = 0; thread < numThreads; thread++) {
+                ASSERT_EQ(0,pthread_join(threads[thread],nullptr));
+            }
+
+            // channels written after the last sweep go out now, once each
+            this->clearBuffs();
+            this->doRun(false);
+            ASSERT_GE(numThreads*CONCURRENT_CHANNELS,this->m_numBuffs);
+        }
+    }
+
     void TlmChanImplTester ::
       from_pingOut_handler(
           const NATIVE_INT_TYPE portNum,
@@ -24,6 +24,9 @@ namespace Svc {
             void runMultiChannel();
             void runOffNominal();
             void runTooManyChannels();
+            void runChannelScaling();
+            void runConcurrentWrites();
+            void runBatchedChannels();
 
         private:
             Svc::TlmChanImpl& m_impl;
@@ -43,7 +46,13 @@ namespace Svc {
 
             // dump functions
             void dumpHash();
-            static void dumpTlmEntry(TlmChanImpl::TlmEntry* entry);
+
+            //! Count the entries on the updated list, which are the entries the next sweep visits
+            NATIVE_UINT_TYPE countUpdated();
+
+            // concurrent write helpers
+            static void* writeTask(void* arg);
+            void checkPattern(Fw::SerializeBufferBase& buff);
             //! Handler for from_pingOut
             //!
             void from_pingOut_handler(
@@ -115,6 +115,66 @@ TEST(TlmChanTest,TooManyChannels) {
 
 }
 
+TEST(TlmChanTest,ChannelScaling) {
+
+    COMMENT("Check a sweep visits only the updated channels as the number of channels grows.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runChannelScaling();
+
+}
+
+TEST(TlmChanTest,ConcurrentWrites) {
+
+    COMMENT("Write channels from several threads while sweeping and reading them back.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runConcurrentWrites();
+
+}
+
+TEST(TlmChanTest,BatchedChannels) {
+
+    COMMENT("Pack multiple channel values into each packet and verify they are extracted correctly.");
+
+    Svc::TlmChanImpl impl("TlmChanImpl");
+
+    impl.init(10,0);
+
+    Svc::TlmChanImplTester tester(impl);
+
+    tester.init();
+
+    // connect ports
+    connectPorts(impl,tester);
+
+    // run test
+    tester.runBatchedChannels();
+
+}
+
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
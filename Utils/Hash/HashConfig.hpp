@@ -7,6 +7,10 @@
 //!
 //! #include <Utils/Hash/openssl/SHA256.hpp>
 //!
-#include <Utils/Hash/libcrc/CRC32.hpp>
+//! Both CRC32 implementations produce identical digests:
+//! libcrc/CRC32.hpp folds one byte per table lookup, while
+//! slicecrc/CRC32.hpp folds eight bytes per step.
+//!
+#include <Utils/Hash/slicecrc/CRC32.hpp>
 
 #endif
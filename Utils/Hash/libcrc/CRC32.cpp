@@ -12,6 +12,9 @@
 
 #include <Utils/Hash/Hash.hpp>
 
+// Only provide the Hash methods when HashConfig.hpp selects this implementation
+#ifdef UTILS_CRC32_CONFIG_HPP
+
 namespace Utils {
 
     Hash ::
@@ -88,3 +91,5 @@ namespace Utils {
       this->hash_handle = ~this->hash_handle;
     }
 }
+
+#endif
@@ -0,0 +1,94 @@
+// ======================================================================
+// \title  CRC32.cpp
+// \brief  cpp file for slice-by-8 CRC32 implementation of Hash class
+//
+// \copyright
+// Copyright 2009-2022, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Utils/Hash/Hash.hpp>
+
+// Only provide the Hash methods when HashConfig.hpp selects this implementation
+#ifdef UTILS_SLICECRC_CRC32_CONFIG_HPP
+
+namespace Utils {
+
+    Hash ::
+        Hash()
+    {
+        this->init();
+    }
+
+    Hash ::
+        ~Hash()
+    {
+    }
+
+    void Hash ::
+        hash(const void *const data, const NATIVE_INT_TYPE len, HashBuffer& buffer)
+    {
+        FW_ASSERT(data);
+        FW_ASSERT(len >= 0, len);
+        const U32 local_hash_handle = SliceCrc32::update(
+            SliceCrc32::INITIAL,
+            data,
+            static_cast<NATIVE_UINT_TYPE>(len)
+        );
+        HashBuffer bufferOut;
+        // For CRC32 we need to return the one's complement of the result:
+        Fw::SerializeStatus status = bufferOut.serialize(~(local_hash_handle));
+        FW_ASSERT( Fw::FW_SERIALIZE_OK == status );
+        buffer = bufferOut;
+    }
+
+    void Hash ::
+        init()
+    {
+        this->hash_handle = SliceCrc32::INITIAL;
+    }
+
+    void Hash ::
+        update(const void *const data, NATIVE_INT_TYPE len)
+    {
+        FW_ASSERT(data);
+        FW_ASSERT(len >= 0, len);
+        this->hash_handle = SliceCrc32::update(
+            this->hash_handle,
+            data,
+            static_cast<NATIVE_UINT_TYPE>(len)
+        );
+    }
+
+    void Hash ::
+        final(HashBuffer& buffer)
+    {
+        HashBuffer bufferOut;
+        // For CRC32 we need to return the one's complement of the result:
+        Fw::SerializeStatus status = bufferOut.serialize(~(this->hash_handle));
+        FW_ASSERT( Fw::FW_SERIALIZE_OK == status );
+        buffer = bufferOut;
+    }
+
+    void Hash ::
+      final(U32 &hashvalue)
+    {
+      FW_ASSERT(sizeof(this->hash_handle) == sizeof(U32));
+      // For CRC32 we need to return the one's complement of the result:
+      hashvalue = ~(this->hash_handle);
+    }
+
+    void Hash ::
+      setHashValue(HashBuffer &value)
+    {
+      Fw::SerializeStatus status = value.deserialize(this->hash_handle);
+      FW_ASSERT( Fw::FW_SERIALIZE_OK == status );
+      // Expecting `value` to already be one's complement; so doing one's complement
+      // here for correct hash updates
+      this->hash_handle = ~this->hash_handle;
+    }
+}
+
+#endif
@@ -0,0 +1,57 @@
+// ======================================================================
+// \title  SliceCrc32.cpp
+// \brief  cpp file for the slice-by-8 CRC32 engine
+//
+// \copyright
+// Copyright 2009-2022, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Utils/Hash/slicecrc/SliceCrc32.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Utils {
+
+    const U32 SliceCrc32::INITIAL;
+
+    U32 SliceCrc32 ::
+        update(U32 crc, const void* const data, const NATIVE_UINT_TYPE len)
+    {
+        FW_ASSERT(data != nullptr || len == 0);
+        const U8* bytes = static_cast<const U8*>(data);
+        NATIVE_UINT_TYPE remaining = len;
+
+        while (remaining >= SLICES) {
+            const U32 low = crc ^
+                (static_cast<U32>(bytes[0]) |
+                (static_cast<U32>(bytes[1]) << 8) |
+                (static_cast<U32>(bytes[2]) << 16) |
+                (static_cast<U32>(bytes[3]) << 24));
+            const U32 high =
+                static_cast<U32>(bytes[4]) |
+                (static_cast<U32>(bytes[5]) << 8) |
+                (static_cast<U32>(bytes[6]) << 16) |
+                (static_cast<U32>(bytes[7]) << 24);
+            crc = TABLES[7][low & 0xFF] ^
+                  TABLES[6][(low >> 8) & 0xFF] ^
+                  TABLES[5][(low >> 16) & 0xFF] ^
+                  TABLES[4][low >> 24] ^
+                  TABLES[3][high & 0xFF] ^
+                  TABLES[2][(high >> 8) & 0xFF] ^
+                  TABLES[1][(high >> 16) & 0xFF] ^
+                  TABLES[0][high >> 24];
+            bytes += SLICES;
+            remaining -= SLICES;
+        }
+        // Fold the tail one byte at a time
+        while (remaining > 0) {
+            crc = (crc >> 8) ^ TABLES[0][(crc ^ *bytes) & 0xFF];
+            ++bytes;
+            --remaining;
+        }
+        return crc;
+    }
+
+}
@@ -0,0 +1,77 @@
+// ======================================================================
+// \title  SliceCrc32.hpp
+// \brief  hpp file for the slice-by-8 CRC32 engine
+//
+// \copyright
+// Copyright 2009-2022, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef UTILS_SLICE_CRC32_HPP
+#define UTILS_SLICE_CRC32_HPP
+
+#include <FpConfig.hpp>
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Utils {
+
+  //! \class SliceCrc32
+  //! \brief Block-oriented CRC32 engine using the slice-by-8 algorithm
+  //!
+  //! Computes the same CRC32 (reflected polynomial 0xEDB88320) as
+  //! update_crc_32() in lib_crc, but folds eight input bytes per step
+  //! through eight precomputed tables. Input bytes are assembled
+  //! explicitly, so the engine is independent of alignment and host
+  //! endianness and needs no special instructions.
+  //!
+  class SliceCrc32 {
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Public constants
+      // ----------------------------------------------------------------------
+
+      enum {
+        SLICES = 8 //!< Number of bytes folded per table step
+      };
+
+      //! Initial value of the CRC register
+      static const U32 INITIAL = 0xFFFFFFFFU;
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Public static methods
+      // ----------------------------------------------------------------------
+
+      //! Update a running CRC register with a block of data
+      //!
+      //! The register uses the same convention as update_crc_32(): start
+      //! from INITIAL and take the one's complement of the final value.
+      //! \param crc: the current CRC register value
+      //! \param data: pointer to start of data
+      //! \param len: length of the data in bytes
+      //! \return the updated CRC register value
+      static U32 update(
+          U32 crc,
+          const void* const data,
+          const NATIVE_UINT_TYPE len
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Private static data
+      // ----------------------------------------------------------------------
+
+      //! The lookup tables, see SliceCrc32Tables.cpp
+      static const U32 TABLES[SLICES][256];
+
+  };
+
+}
+
+#endif
@@ -0,0 +1,61 @@
+// ======================================================================
+// \title  Throughput.cpp
+// \brief  Throughput comparison of the CRC32 hash engines
+//
+// \copyright
+// Copyright 2009-2022, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Utils/Hash/slicecrc/SliceCrc32.hpp>
+extern "C" {
+    #include <Utils/Hash/libcrc/lib_crc.h>
+}
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+    //! Reference CRC computed one byte at a time through lib_crc
+    U32 referenceCrc(U32 crc, const U8* data, NATIVE_UINT_TYPE len) {
+        for (NATIVE_UINT_TYPE i = 0; i < len; i++) {
+            crc = update_crc_32(crc, static_cast<char>(data[i]));
+        }
+        return crc;
+    }
+
+}
+
+// Reports the speed of each engine across input sizes
+int main(int argc, char **argv) {
+    const NATIVE_UINT_TYPE totalBytes = 64 * 1024 * 1024;
+    std::vector<U8> data(1024 * 1024);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<U8>(rand());
+    }
+    printf("%10s %14s %14s\n", "size (B)", "libcrc MB/s", "slicecrc MB/s");
+    for (NATIVE_UINT_TYPE size = 16; size <= data.size(); size *= 4) {
+        const NATIVE_UINT_TYPE iterations = totalBytes / size;
+        volatile U32 sink = 0;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (NATIVE_UINT_TYPE i = 0; i < iterations; i++) {
+            sink = sink + referenceCrc(0xFFFFFFFFU, &data[0], size);
+        }
+        const double referenceSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (NATIVE_UINT_TYPE i = 0; i < iterations; i++) {
+            sink = sink + Utils::SliceCrc32::update(Utils::SliceCrc32::INITIAL, &data[0], size);
+        }
+        const double sliceSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        const double megabytes = static_cast<double>(iterations) * size / (1024.0 * 1024.0);
+        printf("%10u %14.1f %14.1f\n", size, megabytes / referenceSeconds, megabytes / sliceSeconds);
+    }
+    return 0;
+}
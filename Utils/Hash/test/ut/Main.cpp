@@ -0,0 +1,90 @@
+// ======================================================================
+// \title  Main.cpp
+// \brief  Unit tests for the CRC32 hash engines
+//
+// \copyright
+// Copyright 2009-2022, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Utils/Hash/Hash.hpp>
+#include <Utils/Hash/slicecrc/SliceCrc32.hpp>
+extern "C" {
+    #include <Utils/Hash/libcrc/lib_crc.h>
+}
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+    //! Reference CRC computed one byte at a time through lib_crc
+    U32 referenceCrc(U32 crc, const U8* data, NATIVE_UINT_TYPE len) {
+        for (NATIVE_UINT_TYPE i = 0; i < len; i++) {
+            crc = update_crc_32(crc, static_cast<char>(data[i]));
+        }
+        return crc;
+    }
+
+    void fillRandom(std::vector<U8>& data) {
+        for (size_t i = 0; i < data.size(); i++) {
+            data[i] = static_cast<U8>(rand());
+        }
+    }
+
+}
+
+TEST(SliceCrc32Test, KnownVector) {
+    const char* const check = "123456789";
+    const U32 crc = Utils::SliceCrc32::update(
+        Utils::SliceCrc32::INITIAL,
+        check,
+        static_cast<NATIVE_UINT_TYPE>(strlen(check))
+    );
+    ASSERT_EQ(0xCBF43926U, ~crc);
+}
+
+TEST(SliceCrc32Test, MatchesLibCrcForAllLengthsAndOffsets) {
+    std::vector<U8> data(1024 + 8);
+    fillRandom(data);
+    // Vary the start alignment and length so both the 8-byte loop and the tail are covered
+    for (NATIVE_UINT_TYPE offset = 0; offset < 8; offset++) {
+        for (NATIVE_UINT_TYPE len = 0; len <= 1024; len++) {
+            const U32 expected = referenceCrc(0xFFFFFFFFU, &data[offset], len);
+            const U32 actual = Utils::SliceCrc32::update(Utils::SliceCrc32::INITIAL, &data[offset], len);
+            ASSERT_EQ(expected, actual) << "offset " << offset << " length " << len;
+        }
+    }
+}
+
+TEST(SliceCrc32Test, IncrementalMatchesOneShot) {
+    std::vector<U8> data(4096);
+    fillRandom(data);
+    Utils::HashBuffer expected;
+    Utils::Hash::hash(&data[0], static_cast<NATIVE_INT_TYPE>(data.size()), expected);
+
+    for (U32 trial = 0; trial < 100; trial++) {
+        Utils::Hash hash;
+        hash.init();
+        NATIVE_UINT_TYPE index = 0;
+        while (index < data.size()) {
+            NATIVE_UINT_TYPE chunk = static_cast<NATIVE_UINT_TYPE>(rand()) % 67;
+            if (index + chunk > data.size()) {
+                chunk = static_cast<NATIVE_UINT_TYPE>(data.size()) - index;
+            }
+            hash.update(&data[index], static_cast<NATIVE_INT_TYPE>(chunk));
+            index += chunk;
+        }
+        Utils::HashBuffer actual;
+        hash.final(actual);
+        ASSERT_EQ(expected, actual);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
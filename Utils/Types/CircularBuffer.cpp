@@ -16,6 +16,8 @@
 #include <Fw/Types/Assert.hpp>
 #include <Utils/Types/CircularBuffer.hpp>
 
+#include <cstring>
+
 #ifdef CIRCULAR_DEBUG
     #include <Os/Log.hpp>
 #endif
@@ -51,13 +53,13 @@ Fw::SerializeStatus CircularBuffer :: serialize(const U8* const buffer, const NA
     if (size > get_free_size()) {
         return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
     }
-    // Copy in all the supplied data
-    NATIVE_UINT_TYPE idx = advance_idx(m_head_idx, m_allocated_size);
-    for (U32 i = 0; i < size; i++) {
-        FW_ASSERT(idx < m_store_size, idx);
-        m_store[idx] = buffer[i];
-        idx = advance_idx(idx);
-    }
+    // Copy in all the supplied data, splitting the copy where the store wraps
+    const NATIVE_UINT_TYPE idx = advance_idx(m_head_idx, m_allocated_size);
+    FW_ASSERT(idx < m_store_size, idx);
+    const NATIVE_UINT_TYPE to_end = m_store_size - idx;
+    const NATIVE_UINT_TYPE first_size = (size < to_end) ? size : to_end;
+    (void) std::memcpy(m_store + idx, buffer, first_size);
+    (void) std::memcpy(m_store, buffer + first_size, size - first_size);
     m_allocated_size += size;
     FW_ASSERT(m_allocated_size <= this->get_capacity(), m_allocated_size);
     return Fw::FW_SERIALIZE_OK;
@@ -101,12 +103,39 @@ Fw::SerializeStatus CircularBuffer :: peek(U8* buffer, NATIVE_UINT_TYPE size, NA
     if ((size + offset) > m_allocated_size) {
         return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
     }
-    NATIVE_UINT_TYPE idx = advance_idx(m_head_idx, offset);
-    // Deserialize all the bytes from network format
-    for (NATIVE_UINT_TYPE i = 0; i < size; i++) {
-        FW_ASSERT(idx < m_store_size, idx);
-        buffer[i] = m_store[idx];
-        idx = advance_idx(idx);
+    const U8* first = nullptr;
+    const U8* second = nullptr;
+    NATIVE_UINT_TYPE first_size = 0;
+    NATIVE_UINT_TYPE second_size = 0;
+    const Fw::SerializeStatus status = peek_spans(size, offset, first, first_size, second, second_size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    // Copy out the bytes, at most one copy per contiguous region
+    (void) std::memcpy(buffer, first, first_size);
+    if (second_size > 0) {
+        (void) std::memcpy(buffer + first_size, second, second_size);
+    }
+    return Fw::FW_SERIALIZE_OK;
+}
+
+Fw::SerializeStatus CircularBuffer :: peek_spans(NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset,
+                                                 const U8*& first, NATIVE_UINT_TYPE& first_size,
+                                                 const U8*& second, NATIVE_UINT_TYPE& second_size) const {
+    // Check there is sufficient data
+    if ((size + offset) > m_allocated_size) {
+        return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+    }
+    const NATIVE_UINT_TYPE idx = advance_idx(m_head_idx, offset);
+    FW_ASSERT(idx < m_store_size, idx);
+    const NATIVE_UINT_TYPE to_end = m_store_size - idx;
+    first = m_store + idx;
+    if (size <= to_end) {
+        first_size = size;
+        second = nullptr;
+        second_size = 0;
+    } else {
+        first_size = to_end;
+        second = m_store;
+        second_size = size - to_end;
     }
     return Fw::FW_SERIALIZE_OK;
 }
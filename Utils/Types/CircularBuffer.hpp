@@ -78,6 +78,26 @@ class CircularBuffer {
          */
         Fw::SerializeStatus peek(U8* buffer, NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset = 0) const;
 
+        /**
+         * Get the contiguous regions of the data store holding a range of data without moving the head index.
+         * Since the data may wrap around the end of the store, the range is covered by at most two regions. When
+         * the range does not wrap, the second region is empty (nullptr and size 0). This allows callers to operate
+         * on the data in place (e.g. hashing or copying it) rather than byte-by-byte.
+         *
+         * Note: the returned pointers are only valid until the next call to serialize or rotate.
+         *
+         * \param size: size in bytes of the range
+         * \param offset: offset from head to start of the range
+         * \param first: filled with a pointer to the first region
+         * \param first_size: filled with the size of the first region
+         * \param second: filled with a pointer to the second region, or nullptr
+         * \param second_size: filled with the size of the second region, or 0
+         * \return Fw::FW_SERIALIZE_OK on success or something else on error
+         */
+        Fw::SerializeStatus peek_spans(NATIVE_UINT_TYPE size, NATIVE_UINT_TYPE offset,
+                                       const U8*& first, NATIVE_UINT_TYPE& first_size,
+                                       const U8*& second, NATIVE_UINT_TYPE& second_size) const;
+
         /**
          * Rotate the head index, deleting data from the circular buffer and making
          * space. Cannot rotate more than the available space.
@@ -125,6 +125,8 @@ TEST(CircularBufferTests, BasicPeekTest) {
     peekOk.apply(state);
     state.setRandom(sizeof(buffer), 3, 6);
     peekOk.apply(state);
+    state.setRandom(sizeof(buffer), 4, 6);
+    peekOk.apply(state);
 }
 
 /**
@@ -143,6 +145,31 @@ TEST(CircularBufferTests, BasicPeekBadTest) {
     peekBad.apply(state);
     state.setRandom(1024, 3, 6);
     peekBad.apply(state);
+    state.setRandom(1024, 4, 6);
+    peekBad.apply(state);
+}
+
+/**
+ * Test that spans split correctly when the data wraps around the end of the store.
+ */
+TEST(CircularBufferTests, WrappedSpansTest) {
+    MockTypes::CircularState state;
+    Types::SerializeOkRule serializeOk("serializeOk");
+    Types::RotateOkRule rotateOk("rotateOk");
+    Types::PeekOkRule peekOk("peekOk");
+    // Move the head near the end of the store, then serialize across the wrap point
+    state.setRandom(MAX_BUFFER_SIZE - 10, 0, 0);
+    serializeOk.apply(state);
+    rotateOk.apply(state);
+    state.setRandom(100, 0, 0);
+    serializeOk.apply(state);
+    // Spans covering the wrap, starting before and at the wrap point
+    state.setRandom(100, 4, 0);
+    peekOk.apply(state);
+    state.setRandom(90, 4, 10);
+    peekOk.apply(state);
+    state.setRandom(5, 4, 2);
+    peekOk.apply(state);
 }
 
 /**
@@ -0,0 +1,21 @@
+/*
+ * ComLoggerCfg.hpp:
+ *
+ * Configuration settings for the com logger component.
+ */
+
+#ifndef SVC_COMLOGGER_COMLOGGERCFG_HPP_
+#define SVC_COMLOGGER_COMLOGGERCFG_HPP_
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Svc {
+    // Size of the staging buffer that collects records before they are
+    // written to the log file. Records are written in one call when the
+    // buffer fills, when the file is closed, on a schedIn tick, or on the
+    // FlushFile command. It must hold the largest record, a com buffer of
+    // FW_COM_BUFFER_MAX_SIZE bytes plus its U16 length (checked at compile time).
+    // Buffered records are lost if the software stops before they are written.
+    static const U32 COMLOGGER_STAGING_BUFFER_SIZE = 4096;
+}
+
+#endif /* SVC_COMLOGGER_COMLOGGERCFG_HPP_ */
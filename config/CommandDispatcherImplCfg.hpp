@@ -13,6 +13,8 @@
 enum {
     CMD_DISPATCHER_DISPATCH_TABLE_SIZE = 100, // !< The size of the table holding opcodes to dispatch
     CMD_DISPATCHER_SEQUENCER_TABLE_SIZE = 25, // !< The size of the table holding commands in progress
+    CMD_DISPATCHER_DISPATCH_INDEX_SIZE = 2*CMD_DISPATCHER_DISPATCH_TABLE_SIZE, // !< The size of the hash index into the opcode table. Must be larger than the table.
+    CMD_DISPATCHER_SEQUENCER_INDEX_SIZE = 2*CMD_DISPATCHER_SEQUENCER_TABLE_SIZE, // !< The size of the hash index into the commands in progress. Must be larger than the table.
 };
 
 
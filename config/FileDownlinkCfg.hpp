@@ -21,6 +21,21 @@ namespace Svc {
     // Size of the internal file downlink buffer. This must now be static as
     // file down maintains its own internal buffer.
     static const U32 FILEDOWNLINK_INTERNAL_BUFFER_SIZE = FW_COM_BUFFER_MAX_SIZE-sizeof(FwPacketDescriptorType);
+    // Largest number of file packets that may be sent and not yet returned.
+    // File downlink keeps this many internal buffers. The window used is
+    // set by configure; a window of 1 waits for each packet to return before
+    // sending the next.
+    static const U32 FILEDOWNLINK_MAX_WINDOW_SIZE = 4;
+    // Size of the read-ahead buffer for the file being downlinked. File
+    // downlink reads the file in chunks of this size and serves packet-sized
+    // reads from memory, seeking only when a partial downlink jumps. Each
+    // file downlink instance holds one buffer of this size. This trades one
+    // memcpy per packet (from this buffer into the packet buffer) for far
+    // fewer read system calls: the packet data must sit right after its
+    // header in the outgoing buffer, so it cannot point into this buffer.
+    // Reads larger than this buffer bypass it and go straight into the
+    // packet buffer without the copy.
+    static const U32 FILEDOWNLINK_READ_AHEAD_SIZE = 64 * 1024;
 }
 
 #endif /* SVC_FILEDOWNLINK_FILEDOWNLINKCFG_HPP_ */
@@ -0,0 +1,25 @@
+/*
+ * FileUplinkCfg.hpp:
+ *
+ * Configuration settings for file uplink component.
+ */
+
+#ifndef SVC_FILEUPLINK_FILEUPLINKCFG_HPP_
+#define SVC_FILEUPLINK_FILEUPLINKCFG_HPP_
+#include <Fw/Types/BasicTypes.hpp>
+
+namespace Svc {
+    // Size of the write-back buffer for the file being uplinked. Data packets
+    // that continue the buffered run are copied into it; the run is written
+    // when a packet does not continue it, when the buffer fills, and on the
+    // end or cancel packet. Each file uplink instance holds one buffer of
+    // this size.
+    static const U32 FILEUPLINK_WRITE_BUFFER_SIZE = 64 * 1024;
+    // Largest number of disjoint byte ranges tracked for the file being
+    // uplinked. In-order data uses one range; each hole left by a missing
+    // packet uses one more. Data that would need a further range is still
+    // written but is reported as missing at the end of the file.
+    static const U32 FILEUPLINK_MAX_RECEIVED_RANGES = 32;
+}
+
+#endif /* SVC_FILEUPLINK_FILEUPLINKCFG_HPP_ */
@@ -135,6 +135,13 @@
 #define FW_PORT_SERIALIZATION               1   //!< Indicates whether there is code in ports to serialize the call (more code, but ability to serialize calls for multi-note systems)
 #endif
 
+// Async input ports whose arguments are all primitive, enum, or pointer types can queue
+// their arguments as a plain struct copied into the message instead of serializing them
+// one at a time. Applies to components generated by the Python autocoder.
+#ifndef FW_TYPED_ASYNC_MESSAGES
+#define FW_TYPED_ASYNC_MESSAGES             0   //!< Indicates whether eligible async port calls are queued as plain structs (faster, but host-dependent message layout)
+#endif
+
 // Component Facilities
 
 // Serialization
@@ -216,6 +223,22 @@
 #define FW_TASK_NAME_MAX_SIZE               80    //!< Max size of task name
 #endif
 
+// Specifies the limits of an active component pool, which runs active components on a fixed set of
+// worker threads instead of one thread per component
+#ifndef FW_ACTIVE_COMPONENT_POOL_MAX_WORKERS
+#define FW_ACTIVE_COMPONENT_POOL_MAX_WORKERS       16    //!< Max number of worker threads in a pool
+#endif
+
+#ifndef FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS
+#define FW_ACTIVE_COMPONENT_POOL_MAX_COMPONENTS    128   //!< Max number of active components started on a pool
+#endif
+
+// Number of messages a pool worker dispatches for one component before letting other ready components run.
+// The component keeps its place on that worker, so its messages are still handled one at a time in order.
+#ifndef FW_ACTIVE_COMPONENT_POOL_DISPATCH_LIMIT
+#define FW_ACTIVE_COMPONENT_POOL_DISPATCH_LIMIT    16    //!< Max messages dispatched per component turn
+#endif
+
 // Specifies the size of the buffer that contains a communications packet.
 #ifndef FW_COM_BUFFER_MAX_SIZE
 #define FW_COM_BUFFER_MAX_SIZE               128   //!< Max size of Fw::Com buffer
@@ -277,6 +300,11 @@
 #define FW_FILE_BUFFER_MAX_SIZE             255   //!< Max size of file buffer (i.e. chunk of file)
 #endif
 
+// Specifies the size of the stack buffer used to read a file when computing its CRC
+#ifndef FW_FILE_CRC_CHUNK_SIZE
+#define FW_FILE_CRC_CHUNK_SIZE              4096  //!< Bytes read per call by Os::File::calculateCRC32
+#endif
+
 // Specifies the maximum size of a string in an interface call
 #ifndef FW_INTERNAL_INTERFACE_STRING_MAX_SIZE
 #define FW_INTERNAL_INTERFACE_STRING_MAX_SIZE           256   //!< Max size of interface string parameter type
@@ -20,7 +20,11 @@ enum IpCfg {
     SOCKET_IP_RECV_FLAGS = 0,              // recv FLAGS argument
     SOCKET_MAX_ITERATIONS = 0xFFFF,        // Maximum send/recv attempts before an error is returned
     SOCKET_RETRY_INTERVAL_MS = 1000,       // Interval between connection retries before main recv thread starts
-    SOCKET_MAX_HOSTNAME_SIZE = 256         // Maximum stored hostname
+    SOCKET_MAX_HOSTNAME_SIZE = 256,        // Maximum stored hostname
+    SOCKET_SERVER_MAX_CLIENTS = 8,         // Maximum clients connected at once to a multi-client tcp server
+    SOCKET_SERVER_CLIENT_QUEUE_SIZE = 8192, // Bytes queued per multi-client tcp server client. Larger sends are dropped
+    SOCKET_UDP_MAX_BATCH_SIZE = 32,        // Maximum datagrams received or sent by one batched udp call
+    SOCKET_SEND_MAX_GATHER = 4             // Maximum separate buffers gathered into one socket send
 };
 
 